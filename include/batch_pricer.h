@@ -0,0 +1,113 @@
+#ifndef OPTION_PRICING_BATCH_PRICER_H
+#define OPTION_PRICING_BATCH_PRICER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "financial_math.h"
+#include "option_batch.h"
+
+class MonteCarloEngine;
+class ThreadPool;
+
+enum class BatchMethod {
+    BlackScholes,
+    MonteCarlo
+};
+
+struct BatchPricerParameters {
+    BatchMethod method;
+    int num_paths;                  // Monte Carlo only
+    unsigned int random_seed;
+    unsigned int num_threads;       // pricing threads, 0 = every hardware thread
+    std::size_t chunk_options;      // options per pipeline chunk
+    std::size_t chunks_in_flight;   // chunks allocated in total, bounds memory
+    Precision precision{Precision::Double};    // kernel floating-point type, the files stay double
+
+    explicit BatchPricerParameters(
+        const BatchMethod batch_method = BatchMethod::BlackScholes,
+        const int paths = 100000,
+        const unsigned int threads = 0,
+        const std::size_t chunk = 65536,
+        const std::size_t in_flight = 4,
+        const unsigned int seed = 42
+    ) : method{batch_method}, num_paths{paths}, random_seed{seed}, num_threads{threads},
+        chunk_options{chunk}, chunks_in_flight{in_flight} {
+        validate();
+    }
+
+    void validate() const {
+        if (num_paths <= 0) throw std::invalid_argument("Number of paths must be positive");
+        if (chunk_options == 0) throw std::invalid_argument("Chunk size must be positive");
+        if (chunks_in_flight < 3) throw std::invalid_argument("The pipeline needs at least three chunks in flight");
+    }
+};
+
+struct BatchPricingReport {
+    std::uint64_t options{0};
+    std::uint64_t bytes_read{0};
+    std::uint64_t bytes_written{0};
+    double wall_seconds{0.0};
+    double parse_seconds{0.0};      // busy time of each stage; they overlap, so each is <= wall time
+                                    // (for columnar books: mapping both files)
+    double price_seconds{0.0};
+    double format_seconds{0.0};
+
+    [[nodiscard]] double optionsPerSecond() const {
+        return wall_seconds > 0 ? static_cast<double>(options) / wall_seconds : 0.0;
+    }
+};
+
+/**
+ * Streams a CSV book of vanilla options through a parse -> price -> format pipeline
+ * - Input rows are `spot,strike,rate,volatility,expiry,type` with type call|put|c|p; blank lines,
+ *   lines starting with '#' and a leading header row starting with `spot` are skipped
+ * - Output rows are `row,price,std_error,delta,gamma,vega,theta,rho` in input order, row being the
+ *   1-based input line; std_error is empty for Black-Scholes
+ * - A reader thread parses each field once with std::from_chars straight into struct-of-arrays
+ *   chunks, the calling thread prices them on a ThreadPool (SIMD batches for Black-Scholes, one
+ *   single-threaded simulation per option for Monte Carlo), a writer thread formats with
+ *   std::to_chars; all three stages overlap
+ * - A fixed set of chunks_in_flight chunks is recycled between the stages, so memory stays bounded
+ *   by chunk_options regardless of the file size
+ * - A malformed or invalid row throws std::invalid_argument naming its line; output written up
+ *   to that point is left in place
+ */
+class BatchPricer {
+private:
+    BatchPricerParameters parameters_;
+    std::shared_ptr<const MonteCarloEngine> mc_engine_;     // built once, Monte Carlo only
+
+public:
+    explicit BatchPricer(const BatchPricerParameters &parameters = BatchPricerParameters{});
+
+    [[nodiscard]] const BatchPricerParameters &parameters() const { return parameters_; }
+
+    // Pool of num_threads pricing threads, null when that is a single thread
+    [[nodiscard]] std::unique_ptr<ThreadPool> makePool() const;
+
+    /**
+     * Prices an in-memory book, the kernel every mode shares
+     * - Black-Scholes runs priceBatch over slices of the book; Monte Carlo runs one single-threaded
+     *   simulation per option; either is spread over pool when it is not null
+     * - standard_error receives one value per option for Monte Carlo and may be null for Black-Scholes
+     */
+    void price(const OptionBatch &book, const BatchResults &results, double *standard_error, ThreadPool *pool) const;
+
+    // Neither stream is closed; output is flushed before returning
+    BatchPricingReport run(std::FILE *input, std::FILE *output) const;
+
+    /**
+     * Prices a columnar book (see ColumnarFile) into a new columnar results file
+     * - Both files are memory-mapped; the engines read the book's columns and write the results'
+     *   columns in place, nothing is parsed, formatted or copied
+     * - chunk_options and chunks_in_flight do not apply
+     */
+    BatchPricingReport priceBook(const std::string &book_path, const std::string &results_path) const;
+};
+
+#endif //OPTION_PRICING_BATCH_PRICER_H
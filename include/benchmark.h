@@ -1,16 +1,52 @@
 #ifndef OPTION_PRICING_BENCHMARK_H
 #define OPTION_PRICING_BENCHMARK_H
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
 #include <string>
-#include <functional>
+#include <vector>
+#include "running_statistics.h"
 #include "timer.h"
 
+// How long Benchmark::run keeps sampling; a sample is one block of `iterations` calls
+struct SamplingOptions {
+    int warmup_runs{1};
+    int min_samples{3};
+    int max_samples{1000};
+    double min_time_ms{100.0};      // keep sampling until this much time was measured (or max_samples)
+    double outlier_fence{3.0};      // Tukey fence: samples beyond Q1 - k IQR or Q3 + k IQR are rejected
+    double latency_resolution_ns{2000.0};   // shortest timed chunk; calls faster than this are timed in groups
+};
+
+// Per-iteration times in nanoseconds
+struct BenchmarkStatistics {
+    int samples{0};
+    int outliers{0};            // rejected from mean and confidence interval
+    int latency_samples{0};
+    int calls_per_latency_sample{1};
+    double mean{0.0};           // over retained samples
+    double standard_deviation{0.0};
+    double ci_low{0.0};         // 95% confidence interval of the mean (Student t)
+    double ci_high{0.0};
+    double min{0.0};            // min to max: latency samples, outliers included
+    double median{0.0};
+    double p90{0.0};
+    double p99{0.0};
+    double max{0.0};
+};
+
 struct BenchmarkResult {
     std::string name;
-    double time_microseconds;
+    double time_microseconds;   // mean per-iteration time x iterations
     double price;
     int iterations;
+    BenchmarkStatistics statistics;
 
     [[nodiscard]] double time_per_iteration_microseconds() const {
         return time_microseconds / iterations;
@@ -25,29 +61,158 @@ struct BenchmarkResult {
     }
 };
 
+/**
+ * Repeated-sample timing
+ * - warmup_runs untimed calls, then samples of `iterations` calls each until both min_samples
+ *   and min_time_ms are reached, or max_samples
+ * - Samples outside Tukey fences are rejected before the mean and its Student-t confidence
+ *   interval
+ * - Within a sample, calls are timed one at a time, or in the smallest power-of-two group that
+ *   spans latency_resolution_ns when a single call is too short for the clock; min, median,
+ *   p90, p99 and max are over these per-call latencies, outliers included, so a slow call is not
+ *   averaged away by the rest of its block
+ * - All statistics are per iteration, in nanoseconds
+ */
 class Benchmark {
 private:
+    SamplingOptions options_;
     std::vector<BenchmarkResult> results_;
 
+    // Linear interpolation between order statistics, sorted input
+    static double percentile(const std::vector<double> &sorted, const double fraction) {
+        const double position = fraction * static_cast<double>(sorted.size() - 1);
+        const auto lower = static_cast<std::size_t>(position);
+        const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+        return sorted[lower] + (position - static_cast<double>(lower)) * (sorted[upper] - sorted[lower]);
+    }
+
+    // Two-sided 95% Student t quantile
+    static double studentT95(const int degrees_of_freedom) {
+        static constexpr double table[30] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        if (degrees_of_freedom < 1) return 0.0;
+        return degrees_of_freedom <= 30 ? table[degrees_of_freedom - 1] : 1.96 + 2.4 / degrees_of_freedom;
+    }
+
+    [[nodiscard]] static BenchmarkStatistics summarize(
+        std::vector<double> samples,
+        std::vector<double> latencies,
+        const int calls_per_latency,
+        const SamplingOptions &options
+    ) {
+        BenchmarkStatistics stats;
+        std::sort(samples.begin(), samples.end());
+        std::sort(latencies.begin(), latencies.end());
+        stats.samples = static_cast<int>(samples.size());
+        stats.latency_samples = static_cast<int>(latencies.size());
+        stats.calls_per_latency_sample = calls_per_latency;
+        stats.min = latencies.front();
+        stats.max = latencies.back();
+        stats.median = percentile(latencies, 0.5);
+        stats.p90 = percentile(latencies, 0.9);
+        stats.p99 = percentile(latencies, 0.99);
+
+        const double q1 = percentile(samples, 0.25);
+        const double q3 = percentile(samples, 0.75);
+        const double fence = options.outlier_fence * (q3 - q1);
+
+        RunningStatistics kept;
+        for (const double sample: samples) {
+            if (sample < q1 - fence || sample > q3 + fence) {
+                ++stats.outliers;
+                continue;
+            }
+            kept.add(sample);
+        }
+
+        const int retained = static_cast<int>(kept.count());
+        stats.mean = kept.mean();
+        stats.standard_deviation = std::sqrt(kept.variance());
+
+        const double half_width = studentT95(retained - 1) * stats.standard_deviation / std::sqrt(static_cast<double>(retained));
+        stats.ci_low = stats.mean - half_width;
+        stats.ci_high = stats.mean + half_width;
+        return stats;
+    }
+
+    static void writeJsonString(std::ostream &out, const std::string &text) {
+        out << '"';
+        for (const char c: text) {
+            if (c == '"' || c == '\\') out << '\\';
+            out << c;
+        }
+        out << '"';
+    }
+
+    // Numeric value of "key": in one writeJson record, 0 if absent
+    static double readJsonNumber(const std::string &line, const std::string &key) {
+        const std::string field = "\"" + key + "\": ";
+        const std::size_t position = line.find(field);
+        if (position == std::string::npos) return 0.0;
+        return std::strtod(line.c_str() + position + field.size(), nullptr);
+    }
+
 public:
+    explicit Benchmark(const SamplingOptions &options = SamplingOptions{}) : options_{options} {}
+
     template<typename Func>
     BenchmarkResult run(const std::string &name, Func func, const int iterations = 1) {
-        Timer timer;
+        return run(name, func, iterations, options_);
+    }
 
-        // warmup run
-        func();
+    // Same, with sampling options for this run only (e.g. a single sample of a multi-second job)
+    template<typename Func>
+    BenchmarkResult run(const std::string &name, Func func, const int iterations, const SamplingOptions &options) {
+        if (iterations < 1) throw std::invalid_argument("Benchmark iterations must be positive");
 
-        // actual run
-        timer.start();
+        for (int i = 0; i < options.warmup_runs; ++i) {
+            func();
+        }
 
-        double last_price = 0;
-        for (int i = 0; i < iterations; ++i) {
-            last_price = func();
+        Timer timer;
+
+        // Calls per latency sample: doubled (the calls also warm up) until a group spans the resolution
+        int chunk = 1;
+        while (chunk < iterations) {
+            timer.start();
+            for (int i = 0; i < chunk; ++i) {
+                func();
+            }
+            if (timer.elapsedNanoseconds() >= options.latency_resolution_ns) break;
+            chunk *= 2;
         }
+        chunk = std::min(chunk, iterations);
+
+        std::vector<double> samples;
+        std::vector<double> latencies;
+        double last_price = 0;
+        double measured_ns = 0.0;
+        const double min_time_ns = options.min_time_ms * 1e6;
+
+        while (static_cast<int>(samples.size()) < std::max(options.min_samples, 1)
+               || (measured_ns < min_time_ns && static_cast<int>(samples.size()) < options.max_samples)) {
+            double elapsed_ns = 0.0;
+            for (int done = 0; done < iterations; done += chunk) {
+                const int calls = std::min(chunk, iterations - done);
+                timer.start();
+                for (int i = 0; i < calls; ++i) {
+                    last_price = func();
+                }
+                const double chunk_ns = timer.elapsedNanoseconds();
+
+                elapsed_ns += chunk_ns;
+                latencies.push_back(chunk_ns / calls);
+            }
 
-        const double elapsed_us = timer.stop();
+            measured_ns += elapsed_ns;
+            samples.push_back(elapsed_ns / iterations);
+        }
 
-        BenchmarkResult result{name, elapsed_us, last_price, iterations};
+        const BenchmarkStatistics stats = summarize(std::move(samples), std::move(latencies), chunk, options);
+        BenchmarkResult result{name, stats.mean * iterations / 1000.0, last_price, iterations, stats};
         results_.push_back(result);
         return result;
     }
@@ -55,6 +220,74 @@ public:
     [[nodiscard]] const std::vector<BenchmarkResult> &getResults() const { return results_; }
 
     void clear() { results_.clear(); }
+
+    // One JSON array of every recorded result; times in nanoseconds per iteration, printed with
+    // enough digits that readJson recovers the exact doubles
+    void writeJson(std::ostream &out) const {
+        const std::streamsize previous_precision = out.precision(std::numeric_limits<double>::max_digits10);
+        out << "[\n";
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const BenchmarkResult &result = results_[i];
+            const BenchmarkStatistics &stats = result.statistics;
+
+            out << "  {\"name\": ";
+            writeJsonString(out, result.name);
+            out << ", \"iterations\": " << result.iterations
+                << ", \"samples\": " << stats.samples
+                << ", \"outliers\": " << stats.outliers
+                << ", \"latency_samples\": " << stats.latency_samples
+                << ", \"calls_per_latency_sample\": " << stats.calls_per_latency_sample
+                << ", \"mean_ns\": " << stats.mean
+                << ", \"stddev_ns\": " << stats.standard_deviation
+                << ", \"ci95_low_ns\": " << stats.ci_low
+                << ", \"ci95_high_ns\": " << stats.ci_high
+                << ", \"min_ns\": " << stats.min
+                << ", \"median_ns\": " << stats.median
+                << ", \"p90_ns\": " << stats.p90
+                << ", \"p99_ns\": " << stats.p99
+                << ", \"max_ns\": " << stats.max
+                << "}" << (i + 1 < results_.size() ? "," : "") << "\n";
+        }
+        out << "]\n";
+        out.precision(previous_precision);
+    }
+
+    // Parses the output of writeJson, e.g. a saved baseline; price is not stored and reads as 0
+    static std::vector<BenchmarkResult> readJson(std::istream &in) {
+        std::vector<BenchmarkResult> results;
+        const std::string name_field = "\"name\": \"";
+        std::string line;
+
+        while (std::getline(in, line)) {
+            const std::size_t name_start = line.find(name_field);
+            if (name_start == std::string::npos) continue;
+
+            BenchmarkResult result{};
+            for (std::size_t i = name_start + name_field.size(); i < line.size() && line[i] != '"'; ++i) {
+                if (line[i] == '\\' && i + 1 < line.size()) ++i;
+                result.name += line[i];
+            }
+
+            BenchmarkStatistics &stats = result.statistics;
+            result.iterations = static_cast<int>(readJsonNumber(line, "iterations"));
+            stats.samples = static_cast<int>(readJsonNumber(line, "samples"));
+            stats.outliers = static_cast<int>(readJsonNumber(line, "outliers"));
+            stats.latency_samples = static_cast<int>(readJsonNumber(line, "latency_samples"));
+            stats.calls_per_latency_sample = static_cast<int>(readJsonNumber(line, "calls_per_latency_sample"));
+            stats.mean = readJsonNumber(line, "mean_ns");
+            stats.standard_deviation = readJsonNumber(line, "stddev_ns");
+            stats.ci_low = readJsonNumber(line, "ci95_low_ns");
+            stats.ci_high = readJsonNumber(line, "ci95_high_ns");
+            stats.min = readJsonNumber(line, "min_ns");
+            stats.median = readJsonNumber(line, "median_ns");
+            stats.p90 = readJsonNumber(line, "p90_ns");
+            stats.p99 = readJsonNumber(line, "p99_ns");
+            stats.max = readJsonNumber(line, "max_ns");
+            result.time_microseconds = stats.mean * result.iterations / 1000.0;
+            results.push_back(result);
+        }
+        return results;
+    }
 };
 
 #endif //OPTION_PRICING_BENCHMARK_H
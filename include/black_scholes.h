@@ -1,25 +1,70 @@
 #ifndef OPTION_PRICING_BLACK_SCHOLES_H
 #define OPTION_PRICING_BLACK_SCHOLES_H
 
+#include "financial_math.h"
 #include "option.h"
+#include "option_batch.h"
+#include "prepared_option.h"
 #include "pricing_engine.h"
 
-class BlackScholesEngine : public PricingEngine {
+class BlackScholesEngine final : public PricingEngine {
 private:
-    static Greeks calculateAnalyticalGreeks(
-        const Option &option,
-        const MarketParameters &market_parameters,
+    CdfAccuracy cdf_accuracy_;
+
+    // Price and Greeks from d1 and the spot-independent terms, through the kernel for type and accuracy
+    void evaluate(
+        Option::Type type,
+        double spot,
         double d1,
-        double d2
-    ) ;
+        double vol_sqrt_expiry,
+        double sqrt_expiry,
+        double discounted_strike,
+        double theta_decay,
+        double rate,
+        double expiry,
+        CompactPricingResult &out
+    ) const;
 
 public:
+    explicit BlackScholesEngine(const CdfAccuracy cdf_accuracy = CdfAccuracy::Full)
+        : cdf_accuracy_{cdf_accuracy} {}
+
     [[nodiscard]] PricingResult price(
         const Option &option,
         const MarketParameters &market_parameters
     ) const override;
 
+    // Same price and Greeks as price(), without building strings or optionals
+    void priceInto(
+        const Option &option,
+        const MarketParameters &market_parameters,
+        CompactPricingResult &out
+    ) const override;
+
+    // Spot-tick repricing from the prepared terms, same price and Greeks as price()
+    [[nodiscard]] PricingResult price(const PreparedOption &prepared, double spot) const;
+
+    void priceInto(const PreparedOption &prepared, double spot, CompactPricingResult &out) const;
+
+    // Rebinds prepared to the market's rate and volatility if they moved, then prices at its spot
+    [[nodiscard]] PricingResult price(PreparedOption &prepared, const MarketParameters &market_parameters) const;
+
+    /**
+     * Prices a whole book in one pass with the vectorized kernels in simd.h
+     * - Inputs are read from the struct-of-arrays batch, prices and Greeks are written to the caller's arrays
+     * - Greeks use the same units as price(): vega and rho per 1%, theta per day
+     * - The normal CDF/PDF accuracy follows the engine's CdfAccuracy tier
+     * - Only the Greeks with a non-null pointer are computed; price-only, delta-only and all-Greek
+     *   requests, as well as all-call and all-put books, run dedicated kernel instantiations
+     * - Precision::Single rounds the inputs to float and runs twice the lanes with the Fast CDF
+     *   tier; results are widened back to double (errors against Double: see README)
+     * - No validation or allocation: inputs must be positive (spot, strike, volatility, expiry)
+     */
+    void priceBatch(const OptionBatch &batch, const BatchResults &results, Precision precision = Precision::Double) const;
+
     [[nodiscard]] std::string getName() const override;
+
+    [[nodiscard]] EngineId engineId() const override { return EngineId::BlackScholes; }
 };
 
 #endif //OPTION_PRICING_BLACK_SCHOLES_H
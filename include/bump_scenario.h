@@ -0,0 +1,27 @@
+#ifndef OPTION_PRICING_BUMP_SCENARIO_H
+#define OPTION_PRICING_BUMP_SCENARIO_H
+
+#include "market_parameters.h"
+#include "option.h"
+
+// Absolute shifts applied to the pricing inputs, all zero is the base scenario
+struct BumpScenario {
+    double spot_shift{0.0};
+    double volatility_shift{0.0};
+    double rate_shift{0.0};
+    double expiry_shift{0.0};
+
+    [[nodiscard]] MarketParameters apply(const MarketParameters &market) const {
+        return MarketParameters{
+            market.spot_price + spot_shift,
+            market.risk_free_rate + rate_shift,
+            market.volatility + volatility_shift
+        };
+    }
+
+    [[nodiscard]] Option apply(const Option &option) const {
+        return Option{option.getStrike(), option.getType(), option.getExpiry() + expiry_shift};
+    }
+};
+
+#endif //OPTION_PRICING_BUMP_SCENARIO_H
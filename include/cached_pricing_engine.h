@@ -0,0 +1,134 @@
+#ifndef OPTION_PRICING_CACHED_PRICING_ENGINE_H
+#define OPTION_PRICING_CACHED_PRICING_ENGINE_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "pricing_engine.h"
+
+struct CacheParameters {
+    std::size_t capacity;   // total entries over all shards
+    std::size_t num_shards;
+    double tolerance;       // absolute quantization step for strike, expiry, spot, rate and volatility
+
+    explicit CacheParameters(
+        const std::size_t entries = 4096,
+        const std::size_t shards = 16,
+        const double quantum = 1e-8
+    ) : capacity{entries}, num_shards{shards}, tolerance{quantum} {
+        validate();
+    }
+
+    void validate() const {
+        if (num_shards == 0) throw std::invalid_argument("Cache needs at least one shard");
+        if (capacity < num_shards) throw std::invalid_argument("Cache capacity must cover every shard");
+        if (!(tolerance > 0)) throw std::invalid_argument("Cache tolerance must be positive");
+        if (!std::isfinite(1.0 / tolerance)) throw std::invalid_argument("Cache tolerance is too small to quantize by");
+    }
+};
+
+struct CacheStatistics {
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+    std::uint64_t evictions{0};
+    std::size_t size{0};
+
+    [[nodiscard]] double hitRate() const {
+        const std::uint64_t lookups = hits + misses;
+        return lookups > 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+};
+
+/**
+ * Memoizing decorator for any PricingEngine
+ * - Inputs are rounded to multiples of the tolerance; every request in the same bucket gets the
+ *   result computed for the first one
+ * - Bucket indices are whole doubles, so large inputs or tiny tolerances cannot wrap onto another
+ *   key; a request whose index overflows to infinity is priced uncached
+ * - A fixed number of entries is split over independently locked shards picked by key hash, so
+ *   concurrent quoting threads rarely contend; the wrapped engine runs outside the lock
+ * - Full shards evict with CLOCK (second chance): a hit sets the entry's reference bit, the hand
+ *   clears bits until it finds an unreferenced entry
+ * - priceScenarios is forwarded uncached, keeping the engine's common-random-number sweep
+ * - The wrapped engine must outlive the cache
+ */
+class CachedPricingEngine : public PricingEngine {
+private:
+    // Bucket indices, whole and finite, never -0.0
+    struct Key {
+        double strike;
+        double expiry;
+        double spot;
+        double rate;
+        double volatility;
+        Option::Type type;
+
+        bool operator==(const Key &other) const {
+            return strike == other.strike && expiry == other.expiry && spot == other.spot
+                   && rate == other.rate && volatility == other.volatility && type == other.type;
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const;
+    };
+
+    struct Entry {
+        Key key;
+        PricingResult result;
+        bool referenced;
+    };
+
+    // Own cache line per shard so the locks do not false-share
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<Key, std::size_t, KeyHash> index;    // key -> slot
+        std::vector<Entry> slots;
+        std::size_t hand{0};
+        std::uint64_t hits{0};
+        std::uint64_t misses{0};
+        std::uint64_t evictions{0};
+    };
+
+    const PricingEngine &engine_;
+    CacheParameters parameters_;
+    std::size_t shard_capacity_;
+    mutable std::vector<Shard> shards_;
+
+    // std::nullopt when an input is out of the quantizable range
+    [[nodiscard]] std::optional<Key> makeKey(const Option &option, const MarketParameters &market_parameters) const;
+
+    void insert(Shard &shard, const Key &key, const PricingResult &result) const;
+
+public:
+    explicit CachedPricingEngine(const PricingEngine &engine, const CacheParameters &parameters = CacheParameters{});
+
+    [[nodiscard]] PricingResult price(
+        const Option &option,
+        const MarketParameters &market_parameters
+    ) const override;
+
+    [[nodiscard]] std::vector<double> priceScenarios(
+        const Option &option,
+        const MarketParameters &market_parameters,
+        const std::vector<BumpScenario> &scenarios
+    ) const override;
+
+    [[nodiscard]] std::string getName() const override;
+
+    [[nodiscard]] EngineId engineId() const override { return engine_.engineId(); }
+
+    // Counters summed over shards; each shard is read under its own lock
+    [[nodiscard]] CacheStatistics statistics() const;
+
+    // Drops every entry and resets the counters
+    void clear();
+};
+
+#endif //OPTION_PRICING_CACHED_PRICING_ENGINE_H
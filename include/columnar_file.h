@@ -0,0 +1,86 @@
+#ifndef OPTION_PRICING_COLUMNAR_FILE_H
+#define OPTION_PRICING_COLUMNAR_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "option_batch.h"
+
+enum class ColumnarKind : std::uint32_t {
+    Book = 1,       // strike, expiry, type, spot, rate, volatility
+    Results = 2     // price, standard error, delta, gamma, vega, theta, rho
+};
+
+enum class ColumnId : std::uint32_t {
+    Strike, Expiry, Type, Spot, Rate, Volatility,
+    Price, StandardError, Delta, Gamma, Vega, Theta, Rho
+};
+
+/**
+ * Memory-mapped columnar file for option books and pricing results
+ * - Layout: a 64-byte header (magic "OPTCOLS1", byte-order mark, version, kind, column count,
+ *   rows, capacity), a directory of {column id, element size, offset}, then one contiguous
+ *   64-byte aligned column per field holding `capacity` elements
+ * - Columns are host-endian doubles, type is Option::Type stored as a 32-bit integer (0 call,
+ *   1 put); files written on a machine of the other byte order are rejected
+ * - Results carry a standard error column, left at zero by analytical pricing
+ * - bookView() and resultsView() point straight into the mapping, so a book can be priced with
+ *   BlackScholesEngine::priceBatch into a results file without copying either side
+ * - open() validates the header and directory (every column of the kind exactly once, in bounds);
+ *   values are not scanned
+ * - Move-only; the mapping is released on destruction, writable mappings are flushed by the kernel
+ *   (sync() forces it)
+ */
+class ColumnarFile {
+private:
+    unsigned char *data_{nullptr};
+    std::size_t bytes_{0};
+    bool writable_{false};
+
+    ColumnarFile(unsigned char *data, std::size_t bytes, bool writable);
+
+    [[nodiscard]] std::size_t columnOffset(ColumnId id) const;
+    void release();
+
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    ColumnarFile() = default;
+    ~ColumnarFile();
+
+    ColumnarFile(ColumnarFile &&other) noexcept;
+    ColumnarFile &operator=(ColumnarFile &&other) noexcept;
+    ColumnarFile(const ColumnarFile &) = delete;
+    ColumnarFile &operator=(const ColumnarFile &) = delete;
+
+    // Read-only mapping of an existing file
+    static ColumnarFile open(const std::string &path);
+
+    // New file sized for capacity rows of every column of kind, mapped read-write with size() == capacity
+    static ColumnarFile create(const std::string &path, ColumnarKind kind, std::uint64_t capacity);
+
+    // Copies a batch into a new book file
+    static ColumnarFile writeBook(const std::string &path, const OptionBatch &batch);
+
+    // Converts a CSV book (see CsvBookReader) in a single parsing pass; returns the book, rows = data rows
+    static ColumnarFile convertCsv(const std::string &csv_path, const std::string &book_path);
+
+    [[nodiscard]] ColumnarKind kind() const;
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] std::size_t capacity() const;
+    [[nodiscard]] std::size_t bytes() const { return bytes_; }
+
+    // Shrinks the row count after filling fewer than capacity rows; writable files only
+    void resize(std::size_t rows);
+
+    [[nodiscard]] const void *column(ColumnId id) const;
+    [[nodiscard]] void *mutableColumn(ColumnId id);
+
+    [[nodiscard]] OptionBatch bookView() const;
+    [[nodiscard]] BatchResults resultsView();
+
+    void sync();
+};
+
+#endif //OPTION_PRICING_COLUMNAR_FILE_H
@@ -0,0 +1,106 @@
+#ifndef OPTION_PRICING_COMPACT_PRICING_RESULT_H
+#define OPTION_PRICING_COMPACT_PRICING_RESULT_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "pricing_result.h"
+
+enum class EngineId : std::uint8_t {
+    Custom,
+    BlackScholes,
+    MonteCarlo,
+    QuasiMonteCarlo,
+    PathSimulation,
+    Lattice,
+    Pde
+};
+
+[[nodiscard]] inline const char *engineName(const EngineId engine) {
+    switch (engine) {
+        case EngineId::BlackScholes: return "Black-Scholes";
+        case EngineId::MonteCarlo: return "Monte Carlo";
+        case EngineId::QuasiMonteCarlo: return "Quasi-Monte Carlo";
+        case EngineId::PathSimulation: return "Path Monte Carlo";
+        case EngineId::Lattice: return "Lattice";
+        case EngineId::Pde: return "Crank-Nicolson PDE";
+        default: return "Custom";
+    }
+}
+
+enum class Greek : std::uint8_t {
+    Delta,
+    Gamma,
+    Vega,
+    Theta,
+    Rho
+};
+
+/**
+ * Trivially copyable counterpart of PricingResult for hot loops
+ * - No strings or optionals: present Greeks are flagged in greeks_mask, the engine is an EngineId,
+ *   standard_error and paths_used are 0 for analytical engines
+ * - Engines fill caller-owned instances through PricingEngine::priceInto; engines that override it
+ *   (BlackScholesEngine) never touch the heap
+ * - 64 bytes, one cache line per result in an aligned array
+ */
+struct CompactPricingResult {
+    double price;
+    double standard_error;
+    double delta;
+    double gamma;
+    double vega;
+    double theta;
+    double rho;
+    std::int32_t paths_used;
+    std::uint8_t greeks_mask;
+    EngineId engine;
+
+    static constexpr std::uint8_t ALL_GREEKS = 0x1F;
+
+    [[nodiscard]] bool has(const Greek greek) const {
+        return (greeks_mask & (1u << static_cast<unsigned>(greek))) != 0;
+    }
+
+    [[nodiscard]] bool hasGreeks() const { return greeks_mask != 0; }
+
+    [[nodiscard]] static CompactPricingResult fromPricingResult(const PricingResult &result, const EngineId engine) {
+        CompactPricingResult out{};
+        out.price = result.price;
+        out.standard_error = result.standard_error.value_or(0.0);
+        out.paths_used = result.paths_used.value_or(0);
+        out.engine = engine;
+
+        const std::optional<double> *greeks[] = {
+            &result.greeks.delta, &result.greeks.gamma, &result.greeks.vega, &result.greeks.theta, &result.greeks.rho
+        };
+        double *values[] = {&out.delta, &out.gamma, &out.vega, &out.theta, &out.rho};
+        for (unsigned k = 0; k < 5; ++k) {
+            if (greeks[k]->has_value()) {
+                *values[k] = **greeks[k];
+                out.greeks_mask |= static_cast<std::uint8_t>(1u << k);
+            }
+        }
+        return out;
+    }
+
+    // Back to the general type; method_name is the engine's generic name
+    [[nodiscard]] PricingResult toPricingResult() const {
+        Greeks greeks;
+        if (has(Greek::Delta)) greeks.delta = delta;
+        if (has(Greek::Gamma)) greeks.gamma = gamma;
+        if (has(Greek::Vega)) greeks.vega = vega;
+        if (has(Greek::Theta)) greeks.theta = theta;
+        if (has(Greek::Rho)) greeks.rho = rho;
+
+        if (paths_used > 0) {
+            return PricingResult{price, standard_error, paths_used, greeks, engineName(engine)};
+        }
+        return PricingResult{price, greeks, engineName(engine)};
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<CompactPricingResult>, "CompactPricingResult must stay trivially copyable");
+static_assert(sizeof(CompactPricingResult) == 64, "CompactPricingResult should fill one cache line");
+
+#endif //OPTION_PRICING_COMPACT_PRICING_RESULT_H
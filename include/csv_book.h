@@ -0,0 +1,52 @@
+#ifndef OPTION_PRICING_CSV_BOOK_H
+#define OPTION_PRICING_CSV_BOOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+#include "option.h"
+
+struct CsvOptionRow {
+    std::uint64_t line;     // 1-based line in the input
+    double spot;
+    double strike;
+    double rate;
+    double volatility;
+    double expiry;
+    Option::Type type;
+};
+
+/**
+ * Row reader for `spot,strike,rate,volatility,expiry,type` books
+ * - Reads 1 MiB blocks with fread and parses every field once with std::from_chars, no streams
+ * - type is call|put|c|p in any case; blank lines, lines starting with '#' and a leading header
+ *   row whose first field is `spot` (any case) are skipped
+ * - A malformed or invalid row throws std::invalid_argument naming its line
+ */
+class CsvBookReader {
+private:
+    std::FILE *file_;
+    std::vector<char> buffer_;
+    std::size_t begin_{0};
+    std::size_t end_{0};
+    bool eof_{false};
+    bool past_header_{false};
+    std::uint64_t line_number_{0};
+    std::uint64_t bytes_read_{0};
+
+    bool nextLine(std::string_view &line);
+
+public:
+    // The file is not closed
+    explicit CsvBookReader(std::FILE *file);
+
+    // False at end of input
+    bool next(CsvOptionRow &row);
+
+    [[nodiscard]] std::uint64_t bytesRead() const { return bytes_read_; }
+};
+
+#endif //OPTION_PRICING_CSV_BOOK_H
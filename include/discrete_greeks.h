@@ -6,6 +6,12 @@
 #include "market_parameters.h"
 #include "pricing_engine.h"
 
+/**
+ * Bump-and-reprice Greeks for any engine
+ * - All bumps go through one PricingEngine::priceScenarios call, so simulation engines price them
+ *   on common random numbers in a single sweep
+ * - Delta and gamma share the base, spot-up and spot-down prices (central differences)
+ */
 class FiniteDifferenceGreeks {
 private:
     const PricingEngine& engine_;
@@ -16,13 +22,6 @@ public:
         : engine_{engine}, epsilon_{epsilon} {}
 
     [[nodiscard]] Greeks calculate(const Option& option, const MarketParameters& market_parameters) const;
-
-private:
-    [[nodiscard]] double calculateDelta(const Option& option, const MarketParameters& market_parameters, double base_price) const;
-    [[nodiscard]] double calculateGamma(const Option& option, const MarketParameters& market_parameters) const;
-    [[nodiscard]] double calculateVega(const Option& option, const MarketParameters& market_parameters, double base_price) const;
-    [[nodiscard]] double calculateTheta(const Option& option, const MarketParameters& market_parameters, double base_price) const;
-    [[nodiscard]] double calculateRho(const Option& option, const MarketParameters& market_parameters, double base_price) const;
 };
 
-#endif //OPTION_PRICING_DISCRETE_GREEKS_H
\ No newline at end of file
+#endif //OPTION_PRICING_DISCRETE_GREEKS_H
@@ -0,0 +1,68 @@
+#ifndef OPTION_PRICING_IMPLIED_VOLATILITY_H
+#define OPTION_PRICING_IMPLIED_VOLATILITY_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "option.h"
+
+enum class ImpliedVolatilityStatus : std::uint8_t {
+    Converged,
+    PriceBelowIntrinsic,    // no time value left (price <= discounted intrinsic)
+    PriceAboveMaximum,      // call >= spot, put >= discounted strike
+    InvalidInput,           // non-positive spot, strike or expiry, or non-finite inputs
+    NotConverged            // iteration limit reached, volatility holds the last iterate
+};
+
+struct ImpliedVolatilityResult {
+    double volatility;      // NaN unless Converged or NotConverged
+    ImpliedVolatilityStatus status;
+    int iterations;
+};
+
+// Struct-of-arrays view over quoted options, every array holds `size` elements
+struct ImpliedVolatilityBatch {
+    const double *price;
+    const double *strike;
+    const double *expiry;
+    const Option::Type *type;
+    const double *spot;
+    const double *rate;
+    std::size_t size;
+};
+
+// Caller-owned output arrays, iterations may be null
+struct ImpliedVolatilityResults {
+    double *volatility;
+    ImpliedVolatilityStatus *status;
+    int *iterations = nullptr;
+};
+
+/**
+ * Black-Scholes implied volatility by Householder iteration on the normalized price
+ * - Works on x = ln(F/K) and the time value b = (price e^{rT} - intrinsic) / sqrt(F K), mapped to
+ *   the out-of-the-money side (x <= 0); b and its derivatives in s = sigma sqrt(T) are the
+ *   Black-Scholes price and vega in those units
+ * - b(s) has its inflection at s_c = sqrt(2|x|): below b(s_c) the solver iterates on ln b, which
+ *   is close to linear for deep out-of-the-money quotes, above it on b itself; both start from a
+ *   rational initial guess (Jaeckel's lower-branch form, the at-the-money inverse above)
+ * - Third-order Householder steps: typically 2-3 iterations to machine precision; a step below
+ *   RELATIVE_STEP_TOLERANCE ends the iteration, its cubic convergence leaves rounding error only
+ * - Scalar and SIMD batch paths run the same kernel; failures are reported per element, nothing throws
+ * - Accuracy is bounded by the quote: time values below ~1e-13 of the forward carry few digits
+ */
+class ImpliedVolatilitySolver {
+private:
+    int max_iterations_;
+
+public:
+    static constexpr double RELATIVE_STEP_TOLERANCE = 1e-6;
+
+    explicit ImpliedVolatilitySolver(int max_iterations = 10);
+
+    [[nodiscard]] ImpliedVolatilityResult solve(const Option &option, double price, double spot, double rate) const;
+
+    void solveBatch(const ImpliedVolatilityBatch &batch, const ImpliedVolatilityResults &results) const;
+};
+
+#endif //OPTION_PRICING_IMPLIED_VOLATILITY_H
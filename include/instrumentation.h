@@ -0,0 +1,106 @@
+#ifndef OPTION_PRICING_INSTRUMENTATION_H
+#define OPTION_PRICING_INSTRUMENTATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Set to 1 by the OPTION_PRICING_INSTRUMENTATION CMake option; 0 compiles every probe away
+#ifndef OPTION_PRICING_INSTRUMENTATION
+#define OPTION_PRICING_INSTRUMENTATION 0
+#endif
+
+// Timed regions of the hot paths, each with its own counters and latency histogram
+enum class Probe : std::uint8_t {
+    BlackScholesPrice,      // price(): full call including PricingResult construction
+    BlackScholesGreeks,     // analytical Greeks inside price()
+    BlackScholesCompact,    // priceInto(): allocation-free pricing
+    BlackScholesBatch,      // priceBatch(): one call over a whole batch
+    MonteCarloPrice,        // price(): full call
+    MonteCarloRng,          // normal draws (and moment matching) for one block
+    MonteCarloPayoff,       // path evolution, payoffs and pathwise weights for one block
+    MonteCarloStatistics,   // merging blocks and the early-stopping estimates
+    MonteCarloResult,       // estimator, pathwise Greeks and PricingResult construction
+    FiniteDifferenceGreeks, // calculate(): full call
+    FiniteDifferenceBumps,  // the bumped repricings (one priceScenarios sweep)
+    Count
+};
+
+[[nodiscard]] const char *probeName(Probe probe);
+
+struct ProbeStatistics {
+    Probe probe;
+    std::uint64_t count;
+    double total_ns;
+    double mean_ns;
+    double p50_ns;          // percentiles from the histogram, within ~3%
+    double p90_ns;
+    double p99_ns;
+    double max_ns;
+};
+
+/**
+ * Hot-path timing for the pricing engines
+ * - PRICING_SCOPE(probe) times the rest of the enclosing block; with instrumentation compiled out it
+ *   expands to nothing, so release builds pay no cost
+ * - Every thread records into its own counters and histogram (HdrBuckets, shared with the pricing
+ *   server); writes are relaxed atomic stores by the owning thread, no locks and no
+ *   read-modify-write on the hot path
+ * - statistics() merges all threads; it may run concurrently with pricing and then sees a
+ *   slightly stale but consistent-per-counter view
+ * - reset() may also run during pricing: it snapshots each thread's counters as a baseline that
+ *   statistics() subtracts, and owning threads restart their maxima on their next record
+ * - A thread's recorder is recycled when the thread exits, its counts folded into a retired
+ *   total, so short-lived thread pools do not grow the registry; trace thread ids are recorder
+ *   ids and may repeat across threads
+ * - While a trace is active, every scope also appends a complete event to a fixed-size buffer,
+ *   exported with writeChromeTrace() in the Chrome trace-event format (chrome://tracing, Perfetto);
+ *   startTrace() and writeChromeTrace() must not overlap pricing calls
+ */
+namespace Instrumentation {
+    inline constexpr bool compiled_in = OPTION_PRICING_INSTRUMENTATION != 0;
+
+    // Monotonic nanoseconds
+    [[nodiscard]] std::uint64_t now();
+
+    void record(Probe probe, std::uint64_t start_ns, std::uint64_t duration_ns);
+
+    // Probes that recorded at least once, in Probe order
+    [[nodiscard]] std::vector<ProbeStatistics> statistics();
+
+    // Starts every probe over from zero, as seen by statistics()
+    void reset();
+
+    // Events beyond capacity are dropped and counted
+    void startTrace(std::size_t capacity = 1 << 20);
+    void stopTrace();
+    [[nodiscard]] std::size_t droppedTraceEvents();
+
+    // Returns the number of events written
+    std::size_t writeChromeTrace(std::ostream &out);
+
+    class Scope {
+    private:
+        Probe probe_;
+        std::uint64_t start_ns_;
+
+    public:
+        explicit Scope(const Probe probe) : probe_{probe}, start_ns_{now()} {}
+        ~Scope() { record(probe_, start_ns_, now() - start_ns_); }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+}
+
+#define PRICING_SCOPE_CONCAT_INNER(a, b) a##b
+#define PRICING_SCOPE_CONCAT(a, b) PRICING_SCOPE_CONCAT_INNER(a, b)
+
+#if OPTION_PRICING_INSTRUMENTATION
+#define PRICING_SCOPE(probe) const Instrumentation::Scope PRICING_SCOPE_CONCAT(pricing_scope_, __LINE__){probe}
+#else
+#define PRICING_SCOPE(probe) static_cast<void>(0)
+#endif
+
+#endif //OPTION_PRICING_INSTRUMENTATION_H
@@ -0,0 +1,89 @@
+#ifndef OPTION_PRICING_LATENCY_HISTOGRAM_H
+#define OPTION_PRICING_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * HDR-style bucketing shared by the latency histograms (instrumentation probes, pricing server)
+ * - Values below 16 are exact, above that each power of two is split into 16 linear sub-buckets,
+ *   so a bucket's midpoint is within ~3% of any value in it
+ * - Values are clamped below 2^40 (~18 minutes in nanoseconds)
+ * - Percentiles use the nearest-rank rule: the first bucket whose cumulative count reaches
+ *   ceil(fraction x total), capped at the recorded maximum
+ */
+namespace HdrBuckets {
+    inline constexpr int sub_bucket_bits = 4;
+    inline constexpr std::uint64_t sub_buckets = 1u << sub_bucket_bits;
+    inline constexpr int max_exponent = 40;
+    inline constexpr std::size_t count = (max_exponent - sub_bucket_bits + 1) * sub_buckets;
+    inline constexpr std::uint64_t max_value = (std::uint64_t{1} << max_exponent) - 1;
+
+    [[nodiscard]] inline std::size_t index(std::uint64_t value) {
+        value = std::min(value, max_value);
+        if (value < sub_buckets) return static_cast<std::size_t>(value);
+
+#if defined(__GNUC__) || defined(__clang__)
+        const int exponent = 63 - __builtin_clzll(value);
+#else
+        int exponent = 63;
+        while (!(value >> exponent)) --exponent;
+#endif
+        const std::uint64_t sub = (value >> (exponent - sub_bucket_bits)) - sub_buckets;
+        return static_cast<std::size_t>((exponent - sub_bucket_bits + 1) * sub_buckets + sub);
+    }
+
+    // Midpoint of a bucket's value range
+    [[nodiscard]] inline double value(const std::size_t bucket) {
+        if (bucket < sub_buckets) return static_cast<double>(bucket);
+
+        const int exponent = static_cast<int>(bucket / sub_buckets) + sub_bucket_bits - 1;
+        const std::uint64_t sub = bucket % sub_buckets;
+        const int shift = exponent - sub_bucket_bits;
+        const double lower = static_cast<double>((sub_buckets + sub) << shift);
+        return lower + 0.5 * static_cast<double>(std::uint64_t{1} << shift);
+    }
+
+    // buckets holds count plain counters; total is their sum
+    template<typename Buckets>
+    [[nodiscard]] double percentile(const Buckets &buckets, const std::uint64_t total, const double fraction, const double max) {
+        if (total == 0) return 0.0;
+
+        const auto rank = std::max<std::uint64_t>(
+            static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(total))), 1
+        );
+        std::uint64_t seen = 0;
+        for (std::size_t b = 0; b < count; ++b) {
+            seen += buckets[b];
+            if (seen >= rank) return std::min(value(b), max);
+        }
+        return max;
+    }
+}
+
+// Single-threaded latency histogram in nanoseconds over HdrBuckets
+class LatencyHistogram {
+private:
+    std::array<std::uint64_t, HdrBuckets::count> buckets_{};
+    std::uint64_t count_{0};
+    std::uint64_t max_{0};
+
+public:
+    void record(const std::uint64_t nanoseconds) {
+        ++buckets_[HdrBuckets::index(nanoseconds)];
+        ++count_;
+        max_ = std::max(max_, nanoseconds);
+    }
+
+    [[nodiscard]] double percentile(const double fraction) const {
+        return HdrBuckets::percentile(buckets_, count_, fraction, static_cast<double>(max_));
+    }
+
+    [[nodiscard]] std::uint64_t count() const { return count_; }
+    [[nodiscard]] double max() const { return static_cast<double>(max_); }
+};
+
+#endif //OPTION_PRICING_LATENCY_HISTOGRAM_H
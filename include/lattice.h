@@ -0,0 +1,66 @@
+#ifndef OPTION_PRICING_LATTICE_H
+#define OPTION_PRICING_LATTICE_H
+
+#include <stdexcept>
+
+#include "option.h"
+#include "pricing_engine.h"
+
+enum class LatticeType {
+    CoxRossRubinstein,  // binomial, u = e^{sigma sqrt(dt)}, d = 1 / u
+    LeisenReimer,       // binomial centred on the strike via Peizer-Pratt inversion, odd step count
+    Trinomial           // log-space trinomial, dx = sigma sqrt(3 dt)
+};
+
+struct LatticeParameters {
+    int num_steps;
+    LatticeType type;
+    ExerciseStyle exercise;
+
+    // Leisen-Reimer rounds an even step count up to the next odd one
+    explicit LatticeParameters(
+        const int steps = 1000,
+        const LatticeType lattice = LatticeType::CoxRossRubinstein,
+        const ExerciseStyle style = ExerciseStyle::American
+    ) : num_steps{steps}, type{lattice}, exercise{style} {
+        validate();
+    }
+
+    void validate() const {
+        if (num_steps < 2) throw std::invalid_argument("Lattice needs at least two steps");
+    }
+};
+
+/**
+ * Binomial and trinomial lattices with optional early exercise
+ * - Backward induction runs in place over one thread_local buffer of node values (plus one of
+ *   node spots), so memory is O(num_steps) and repeated pricings do not allocate
+ * - Each time step is a single ascending SIMD sweep of max(discounted continuation, exercise);
+ *   in place is safe because node j only reads nodes j, j + 1 (and j + 2) of the later step
+ * - Delta, gamma and theta come from the node values at the first two steps, kept on the way
+ *   down; vega and rho are not available from one lattice and are left empty
+ * - Greek units match BlackScholesEngine (theta per day)
+ */
+class LatticeEngine : public PricingEngine {
+private:
+    LatticeParameters parameters_;
+
+    [[nodiscard]] PricingResult priceBinomial(const Option &option, const MarketParameters &market_parameters) const;
+    [[nodiscard]] PricingResult priceTrinomial(const Option &option, const MarketParameters &market_parameters) const;
+
+public:
+    explicit LatticeEngine(const LatticeParameters &parameters = LatticeParameters{});
+
+    [[nodiscard]] PricingResult price(
+        const Option &option,
+        const MarketParameters &market_parameters
+    ) const override;
+
+    [[nodiscard]] std::string getName() const override;
+
+    [[nodiscard]] EngineId engineId() const override { return EngineId::Lattice; }
+
+    [[nodiscard]] const LatticeParameters &getLatticeParameters() const { return parameters_; }
+};
+
+#endif //OPTION_PRICING_LATTICE_H
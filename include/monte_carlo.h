@@ -1,33 +1,151 @@
 #ifndef OPTION_PRICING_MONTE_CARLO_H
 #define OPTION_PRICING_MONTE_CARLO_H
 
+#include "financial_math.h"
 #include "option.h"
 #include "pricing_engine.h"
-#include <random>
+#include "running_statistics.h"
+#include "thread_pool.h"
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+enum class ControlVariate {
+    None,
+    TerminalSpot,   // S_T, known mean S_0 e^{rT}
+    BlackScholes    // same-type vanilla struck at (or near) the forward, known mean from BlackScholesEngine
+};
 
 struct SimulationParameters {
     int num_paths;
     unsigned int random_seed;
+    unsigned int num_threads;
+
+    // Variance reduction
+    bool antithetic{false};                                 // pair every shock Z with -Z
+    ControlVariate control_variate{ControlVariate::None};   // regression-adjusted control
+    bool moment_matching{false};                            // rescale each block's shocks to mean 0, variance 1
+
+    // Greeks from the pricing paths (pathwise delta/vega/theta/rho, likelihood-ratio gamma)
+    bool compute_greeks{true};
 
-    explicit SimulationParameters(const int paths = 100000, const unsigned int seed = 42)
-        : num_paths{paths}, random_seed{seed} {
+    // Single: terminal spots in float, twice the SIMD lanes; statistics stay double
+    Precision precision{Precision::Double};
+
+    // Early stopping, 0 = off; num_paths then acts as the upper bound
+    double target_standard_error{0.0};  // stop once the discounted standard error is at or below this
+    double time_budget_ms{0.0};         // stop at the first check after this much wall time
+
+    // num_threads = 0 uses every hardware thread; results do not depend on it
+    explicit SimulationParameters(const int paths = 100000, const unsigned int seed = 42, const unsigned int threads = 1)
+        : num_paths{paths}, random_seed{seed}, num_threads{threads} {
         validate();
     }
 
     void validate() const {
         if (num_paths <= 0) throw std::invalid_argument("Number of paths must be positive");
+        if (target_standard_error < 0) throw std::invalid_argument("Target standard error must be non-negative");
+        if (time_budget_ms < 0) throw std::invalid_argument("Time budget must be non-negative");
     }
 };
 
-class MonteCarloEngine : public PricingEngine {
+// Per-block accumulators, merged in block order
+struct SimulationStatistics {
+    RunningStatistics paths;    // every simulated payoff, the plain Monte Carlo reference
+    RunningCovariance units;    // x = estimator unit (pair average when antithetic), y = control
+
+    // Pathwise sums over in-the-money paths of w = omega * S_T times the Greek's path weight
+    double itm_spot{0.0};       // w
+    double gamma_weight{0.0};   // w * (Z / (sigma sqrt(T)) - 1)
+    double vega_weight{0.0};    // w * (sqrt(T) Z - sigma T)
+    double time_weight{0.0};    // w * (r - sigma^2 / 2 + sigma Z / (2 sqrt(T)))
+
+    void merge(const SimulationStatistics &other) {
+        paths.merge(other.paths);
+        units.merge(other.units);
+        itm_spot += other.itm_spot;
+        gamma_weight += other.gamma_weight;
+        vega_weight += other.vega_weight;
+        time_weight += other.time_weight;
+    }
+};
+
+/**
+ * European Monte Carlo under geometric Brownian motion
+ * - Paths are split into fixed blocks of PATHS_PER_BLOCK; block b draws its normals from the
+ *   Philox stream (random_seed, b), so path i always sees the same shock
+ * - Each block keeps a RunningStatistics; blocks run on a thread pool and are merged in block
+ *   order, making the price and standard error bit-identical for any num_threads
+ * - Memory is constant in num_paths: only one round of block accumulators is alive at a time
+ * - With a target standard error the engine stops after the first block at which the target is
+ *   met (also independent of num_threads); a time budget is checked between rounds
+ * - price() holds no mutable state and is safe to call from several threads
+ * - Precision::Single draws float normals (FloatNormalStream, four per Philox block) and
+ *   evaluates S_T = S_0 exp(...) a chunk at a time in float; moment matching, payoff statistics and
+ *   Greek sums stay double, so the standard error is as reliable as in Double. The draws differ
+ *   from Double's, so the two agree within their standard errors rather than to rounding
+ *
+ * Variance reduction
+ * - Antithetic: num_paths counts both legs (an odd count is rounded up), a pair (Z, -Z) is one
+ *   estimator unit
+ * - Control variate: coefficient estimated from the same paths; ControlVariate::BlackScholes uses
+ *   the same-type vanilla struck at the forward, or 5% of the forward away from the option's own
+ *   strike when that is nearer, so the control is correlated with the payoff but never equal to it
+ * - Moment matching is applied per block, so it stays thread-count independent; the reported
+ *   standard error treats the matched draws as independent
+ * - variance_reduction_factor = plain per-path variance / (paths per unit x unit variance)
+ *
+ * Greeks (compute_greeks, same units as BlackScholesEngine)
+ * - Delta, vega, theta and rho differentiate each path's discounted payoff with respect to the
+ *   parameter; gamma applies the likelihood-ratio score of S_0 to the pathwise delta, since the
+ *   payoff's kink makes a second pathwise derivative vanish
+ * - All of them come from the pricing paths themselves, no repricing; the control variate only
+ *   adjusts the price
+ */
+class MonteCarloEngine final : public PricingEngine {
 private:
     SimulationParameters simulation_parameters_;
-    mutable std::mt19937 generator_;
-    mutable std::normal_distribution<double> distribution_;
+    std::shared_ptr<ThreadPool> thread_pool_;
+
+    struct Estimate {
+        double mean;
+        double standard_error;
+        double variance_reduction_factor;
+    };
+
+    // Block's shocks after moment matching; one per pair when antithetic; Real = float draws from FloatNormalStream
+    template<typename Real>
+    [[nodiscard]] std::vector<Real> generateShocks(std::size_t block) const;
+
+    [[nodiscard]] SimulationStatistics simulateBlock(
+        const Option& option,
+        const MarketParameters& market_parameters,
+        std::size_t block
+    ) const;
 
-    double simulatePath(const MarketParameters& market, double expiry) const;
+    // Adds each scenario's undiscounted payoff sum over the block's paths to sums, returns the path count
+    std::int64_t simulateScenarioBlock(
+        const std::vector<Option>& options,
+        const std::vector<MarketParameters>& markets,
+        std::size_t block,
+        std::vector<double>& sums
+    ) const;
+
+    // Known (undiscounted) expectation of the control, 0 without one
+    [[nodiscard]] double controlMean(const Option& option, const MarketParameters& market_parameters) const;
+
+    // Undiscounted estimate, control_mean is the known expectation of the control
+    [[nodiscard]] Estimate estimate(const SimulationStatistics& stats, double control_mean) const;
+
+    [[nodiscard]] static Greeks pathwiseGreeks(
+        const SimulationStatistics& stats,
+        const MarketParameters& market_parameters,
+        double expiry
+    );
 
 public:
+    static constexpr int PATHS_PER_BLOCK = 8192;
+
     explicit MonteCarloEngine(const SimulationParameters& parameters = SimulationParameters{});
 
     PricingResult price(
@@ -35,7 +153,37 @@ public:
         const MarketParameters& market_parameters
     ) const override;
 
+    // Every scenario reuses the same shocks (common random numbers); plain path averages, the
+    // control variate and early stopping only apply to price()
+    std::vector<double> priceScenarios(
+        const Option& option,
+        const MarketParameters& market_parameters,
+        const std::vector<BumpScenario>& scenarios
+    ) const override;
+
     std::string getName() const override;
+
+    EngineId engineId() const override { return EngineId::MonteCarlo; }
+
+    // Building blocks for callers that schedule blocks themselves (PortfolioPricer); merging
+    // simulateBlocks over consecutive ranges in order and calling makeResult matches price()
+    // without early stopping up to rounding (bit-identical for a fixed range split)
+    [[nodiscard]] std::size_t blockCount() const;
+
+    [[nodiscard]] SimulationStatistics simulateBlocks(
+        const Option& option,
+        const MarketParameters& market_parameters,
+        std::size_t first_block,
+        std::size_t last_block
+    ) const;
+
+    [[nodiscard]] PricingResult makeResult(
+        const SimulationStatistics& stats,
+        const Option& option,
+        const MarketParameters& market_parameters
+    ) const;
+
+    [[nodiscard]] const SimulationParameters& getSimulationParameters() const { return simulation_parameters_; }
 };
 
-#endif //OPTION_PRICING_MONTE_CARLO_H
\ No newline at end of file
+#endif //OPTION_PRICING_MONTE_CARLO_H
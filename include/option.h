@@ -1,6 +1,11 @@
 #ifndef OPTION_PRICING_OPTION_H
 #define OPTION_PRICING_OPTION_H
 
+enum class ExerciseStyle {
+    European,
+    American
+};
+
 class Option {
 public:
     enum class Type {
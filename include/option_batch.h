@@ -0,0 +1,29 @@
+#ifndef OPTION_PRICING_OPTION_BATCH_H
+#define OPTION_PRICING_OPTION_BATCH_H
+
+#include <cstddef>
+
+#include "option.h"
+
+// Struct-of-arrays view over a book of vanilla options, every array holds `size` elements
+struct OptionBatch {
+    const double *strike;
+    const double *expiry;
+    const Option::Type *type;
+    const double *spot;
+    const double *rate;
+    const double *volatility;
+    std::size_t size;
+};
+
+// Caller-owned output arrays, a null Greek pointer skips that Greek
+struct BatchResults {
+    double *price;
+    double *delta = nullptr;
+    double *gamma = nullptr;
+    double *vega = nullptr;
+    double *theta = nullptr;
+    double *rho = nullptr;
+};
+
+#endif //OPTION_PRICING_OPTION_BATCH_H
@@ -0,0 +1,52 @@
+#ifndef OPTION_PRICING_PATH_DEPENDENT_OPTION_H
+#define OPTION_PRICING_PATH_DEPENDENT_OPTION_H
+
+#include <stdexcept>
+
+#include "option.h"
+
+/**
+ * Vanilla payoff on a path-dependent underlying quantity
+ * - Asians pay on the average of the fixings at the simulation steps (t_0 excluded)
+ * - Barriers are monitored continuously and pay the vanilla payoff at expiry if alive (out)
+ *   or knocked in (in); no rebate
+ */
+class PathDependentOption {
+public:
+    enum class Style {
+        European,
+        ArithmeticAsian,
+        GeometricAsian,
+        UpAndOut,
+        UpAndIn,
+        DownAndOut,
+        DownAndIn
+    };
+
+private:
+    Option vanilla_;
+    Style style_;
+    double barrier_;
+
+public:
+    PathDependentOption(const Option &vanilla, const Style style, const double barrier = 0.0)
+        : vanilla_{vanilla}, style_{style}, barrier_{barrier} {
+        validate();
+    }
+
+    void validate() const {
+        if (vanilla_.getExpiry() <= 0) throw std::invalid_argument("Expiry must be positive");
+        if (isBarrier() && barrier_ <= 0) throw std::invalid_argument("Barrier must be positive");
+    }
+
+    [[nodiscard]] const Option &getVanilla() const { return vanilla_; }
+    [[nodiscard]] Style getStyle() const { return style_; }
+    [[nodiscard]] double getBarrier() const { return barrier_; }
+
+    [[nodiscard]] bool isBarrier() const {
+        return style_ == Style::UpAndOut || style_ == Style::UpAndIn
+               || style_ == Style::DownAndOut || style_ == Style::DownAndIn;
+    }
+};
+
+#endif //OPTION_PRICING_PATH_DEPENDENT_OPTION_H
@@ -0,0 +1,95 @@
+#ifndef OPTION_PRICING_PDE_H
+#define OPTION_PRICING_PDE_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "option.h"
+#include "option_batch.h"
+#include "pricing_engine.h"
+
+struct PdeParameters {
+    int num_space_steps;
+    int num_time_steps;             // over the longest expiry of a solve
+    ExerciseStyle exercise;
+    int rannacher_steps{2};         // leading steps replaced by two implicit half steps each
+    double grid_concentration{0.1}; // sinh grid width around the strike, in moneyness S / K
+    double grid_std_devs{5.0};      // upper grid edge in standard deviations above the highest spot / strike
+
+    explicit PdeParameters(
+        const int space_steps = 400,
+        const int time_steps = 200,
+        const ExerciseStyle style = ExerciseStyle::European
+    ) : num_space_steps{space_steps}, num_time_steps{time_steps}, exercise{style} {
+        validate();
+    }
+
+    void validate() const {
+        if (num_space_steps < 3) throw std::invalid_argument("PDE grid needs at least three space steps");
+        if (num_time_steps < 1) throw std::invalid_argument("Number of time steps must be positive");
+        if (rannacher_steps < 0) throw std::invalid_argument("Rannacher steps must be non-negative");
+        if (grid_concentration <= 0) throw std::invalid_argument("Grid concentration must be positive");
+        if (grid_std_devs <= 0) throw std::invalid_argument("Grid width must be positive");
+    }
+};
+
+/**
+ * Crank-Nicolson finite differences for the Black-Scholes PDE
+ * - Solves in moneyness m = S / K with unit strike, so by homogeneity, V(S, K) = K v(S / K),
+ *   one solve prices every strike of a type; the backward sweep in time to expiry passes through
+ *   every shorter expiry, so one solve also covers a whole expiry grid
+ * - Non-uniform sinh grid on [0, m_max], dense around m = 1 where the payoff kinks
+ * - Rannacher start: the first steps are fully implicit half steps, damping the oscillations CN
+ *   shows on the kink
+ * - Each step is one Thomas solve; the LU factors of the constant tridiagonal matrix are computed
+ *   once per time step size and stored interleaved, so forward and back substitution stream one array
+ * - Early exercise by projection onto the payoff after every step
+ * - Grid, operator, factors and solution layers live in a thread_local workspace reused across calls
+ * - Delta and gamma are the derivatives of the quadratic through the three grid nodes nearest the
+ *   spot, theta is the difference to the previous time layer (per day); vega and rho are not available
+ */
+class PdeEngine : public PricingEngine {
+private:
+    PdeParameters parameters_;
+
+public:
+    explicit PdeEngine(const PdeParameters &parameters = PdeParameters{});
+
+    [[nodiscard]] PricingResult price(
+        const Option &option,
+        const MarketParameters &market_parameters
+    ) const override;
+
+    /**
+     * Prices the strikes x expiries grid of one option type from a single solve
+     * - Output index is expiry * num_strikes + strike; expiries may come in any order
+     * - Writes price, delta, gamma and theta where the pointers are set; vega and rho are ignored
+     */
+    void priceGrid(
+        Option::Type type,
+        const double *strikes,
+        std::size_t num_strikes,
+        const double *expiries,
+        std::size_t num_expiries,
+        const MarketParameters &market_parameters,
+        const BatchResults &results
+    ) const;
+
+    // All strikes of one expiry, output index = strike index
+    void priceStrikes(
+        Option::Type type,
+        double expiry,
+        const double *strikes,
+        std::size_t num_strikes,
+        const MarketParameters &market_parameters,
+        const BatchResults &results
+    ) const;
+
+    [[nodiscard]] std::string getName() const override;
+
+    [[nodiscard]] EngineId engineId() const override { return EngineId::Pde; }
+
+    [[nodiscard]] const PdeParameters &getPdeParameters() const { return parameters_; }
+};
+
+#endif //OPTION_PRICING_PDE_H
@@ -0,0 +1,164 @@
+#ifndef OPTION_PRICING_PHILOX_H
+#define OPTION_PRICING_PHILOX_H
+
+#include "simd.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Philox4x32-10 counter-based random number generator
+ * - Source: Salmon, Moraes, Dror, Shaw (2011), "Parallel Random Numbers: As Easy as 1, 2, 3"
+ * - Output is a pure function of (counter, key): any draw can be computed on any thread
+ *   without shared state, which makes parallel simulations reproducible
+ */
+class Philox4x32 {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter counter, Key key) {
+        for (int round = 0; round < 10; ++round) {
+            counter = applyRound(counter, key);
+            key[0] += weyl_0;
+            key[1] += weyl_1;
+        }
+        return counter;
+    }
+
+private:
+    static constexpr std::uint32_t multiplier_0 = 0xD2511F53;
+    static constexpr std::uint32_t multiplier_1 = 0xCD9E8D57;
+    static constexpr std::uint32_t weyl_0 = 0x9E3779B9;
+    static constexpr std::uint32_t weyl_1 = 0xBB67AE85;
+
+    static Counter applyRound(const Counter &counter, const Key &key) {
+        const std::uint64_t product_0 = static_cast<std::uint64_t>(multiplier_0) * counter[0];
+        const std::uint64_t product_1 = static_cast<std::uint64_t>(multiplier_1) * counter[2];
+
+        return Counter{
+            static_cast<std::uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0],
+            static_cast<std::uint32_t>(product_1),
+            static_cast<std::uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1],
+            static_cast<std::uint32_t>(product_0)
+        };
+    }
+};
+
+/**
+ * Standard normal draws for one (seed, stream) pair
+ * - Draw k of a stream is fixed by (seed, stream, k), independent of which thread asks for it
+ * - Each Philox block gives two 53-bit uniforms in (0, 1), mapped to two normals by Box-Muller
+ */
+class NormalStream {
+private:
+    Philox4x32::Key key_;
+    std::uint64_t stream_;
+    std::uint32_t block_;
+    double cached_;
+    bool has_cached_;
+
+public:
+    NormalStream(const std::uint64_t seed, const std::uint64_t stream)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+          stream_{stream}, block_{0}, cached_{0.0}, has_cached_{false} {}
+
+    double next() {
+        if (has_cached_) {
+            has_cached_ = false;
+            return cached_;
+        }
+
+        const Philox4x32::Counter bits = Philox4x32::generate(
+            {static_cast<std::uint32_t>(stream_), static_cast<std::uint32_t>(stream_ >> 32), block_++, 0},
+            key_
+        );
+
+        const double u1 = toUniform(bits[0], bits[1]);
+        const double u2 = toUniform(bits[2], bits[3]);
+
+        static constexpr double two_pi = 6.283185307179586;
+        const double radius = std::sqrt(-2.0 * std::log(u1));
+        const double angle = two_pi * u2;
+
+        cached_ = radius * std::sin(angle);
+        has_cached_ = true;
+        return radius * std::cos(angle);
+    }
+
+private:
+    // 53 random bits centred in their interval, never 0 or 1
+    static double toUniform(const std::uint32_t high, const std::uint32_t low) {
+        const std::uint64_t bits = ((static_cast<std::uint64_t>(high) << 32) | low) >> 11;
+        return (static_cast<double>(bits) + 0.5) * 0x1.0p-53;
+    }
+};
+
+/**
+ * Single-precision standard normal draws for one (seed, stream) pair, NormalStream's counterpart
+ * for Precision::Single
+ * - Each Philox block gives four 23-bit uniforms in (0, 1), two Box-Muller pairs, so a block
+ *   yields four normals instead of two; pairs run on Simd::FloatVec lanes
+ * - Draw k is fixed by (seed, stream, k) and the vector width only changes rounding
+ * - The smallest uniform is 2^-24, which caps |Z| at ~5.77 (a tail probability of ~8e-9)
+ */
+class FloatNormalStream {
+private:
+    Philox4x32::Key key_;
+    std::uint64_t stream_;
+    std::uint32_t block_;
+
+public:
+    FloatNormalStream(const std::uint64_t seed, const std::uint64_t stream)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+          stream_{stream}, block_{0} {}
+
+    // Writes count draws; a later call starts at the next unused Philox block
+    void fill(float *out, const std::size_t count) {
+        using Simd::FloatVec;
+        static constexpr std::size_t lanes = FloatVec::width;
+        static constexpr std::size_t step = lanes < 2 ? 2 : lanes;   // pairs per step, whole Philox blocks
+
+        float u1[step];
+        float u2[step];
+        float cosine_draws[step];
+        float sine_draws[step];
+
+        for (std::size_t first = 0; first < count; first += 2 * step) {
+            for (std::size_t pair = 0; pair < step; pair += 2) {
+                const Philox4x32::Counter bits = Philox4x32::generate(
+                    {static_cast<std::uint32_t>(stream_), static_cast<std::uint32_t>(stream_ >> 32), block_++, 0},
+                    key_
+                );
+                u1[pair] = toUniform(bits[0]);
+                u2[pair] = toUniform(bits[1]);
+                u1[pair + 1] = toUniform(bits[2]);
+                u2[pair + 1] = toUniform(bits[3]);
+            }
+
+            for (std::size_t lane = 0; lane < step; lane += lanes) {
+                const FloatVec radius = Simd::sqrt(-2.0f * Simd::log(FloatVec::load(u1 + lane)));
+                FloatVec sine;
+                FloatVec cosine;
+                Simd::sinCosTurns(FloatVec::load(u2 + lane), sine, cosine);
+                (radius * cosine).store(cosine_draws + lane);
+                (radius * sine).store(sine_draws + lane);
+            }
+
+            // Same order as NormalStream: cosine, then sine of each pair
+            const std::size_t written = count - first < 2 * step ? count - first : 2 * step;
+            for (std::size_t k = 0; k < written; ++k) {
+                out[first + k] = (k % 2 == 0 ? cosine_draws : sine_draws)[k / 2];
+            }
+        }
+    }
+
+private:
+    // 23 random bits centred in their interval, exact in float and never 0 or 1
+    static float toUniform(const std::uint32_t bits) {
+        return (static_cast<float>(bits >> 9) + 0.5f) * 0x1.0p-23f;
+    }
+};
+
+#endif //OPTION_PRICING_PHILOX_H
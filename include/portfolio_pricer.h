@@ -0,0 +1,80 @@
+#ifndef OPTION_PRICING_PORTFOLIO_PRICER_H
+#define OPTION_PRICING_PORTFOLIO_PRICER_H
+
+#include <memory>
+#include <vector>
+
+#include "black_scholes.h"
+#include "market_parameters.h"
+#include "monte_carlo.h"
+#include "option.h"
+#include "pricing_result.h"
+#include "quasi_monte_carlo.h"
+#include "work_stealing_pool.h"
+
+enum class EngineType {
+    BlackScholes,
+    MonteCarlo,
+    QuasiMonteCarlo
+};
+
+struct PricingJob {
+    Option option;
+    MarketParameters market;
+    EngineType engine;
+};
+
+struct JobResult {
+    PricingResult result;
+    double latency_microseconds;    // from the start of the portfolio run to this job's completion
+};
+
+struct PortfolioReport {
+    std::vector<JobResult> jobs;    // in input order
+    double wall_time_microseconds;
+    double mean_latency_microseconds;
+    double median_latency_microseconds;
+    double p99_latency_microseconds;
+    double max_latency_microseconds;
+
+    [[nodiscard]] double jobsPerSecond() const {
+        return static_cast<double>(jobs.size()) / (wall_time_microseconds / 1000000.0);
+    }
+};
+
+/**
+ * Prices a list of jobs concurrently on a WorkStealingPool
+ * - Every worker owns its engines; Monte Carlo engines run single-threaded inside a worker
+ * - Black-Scholes jobs are high priority, so they never queue behind simulations
+ * - Monte Carlo jobs without early stopping are split into sub-tasks of BLOCKS_PER_TASK blocks;
+ *   the last sub-task to finish merges them in block order, so a job's result does not depend
+ *   on which workers ran it
+ * - price() may be called from several threads; calls share the workers
+ */
+class PortfolioPricer {
+private:
+    struct WorkerEngines {
+        BlackScholesEngine black_scholes;
+        MonteCarloEngine monte_carlo;
+        QuasiMonteCarloEngine quasi_monte_carlo;
+    };
+
+    std::vector<std::unique_ptr<WorkerEngines>> engines_;
+    std::unique_ptr<WorkStealingPool> pool_;
+
+public:
+    static constexpr std::size_t BLOCKS_PER_TASK = 4;
+
+    // simulation.num_threads is ignored, the pool provides the parallelism
+    explicit PortfolioPricer(
+        unsigned int num_threads = 0,
+        const SimulationParameters &simulation = SimulationParameters{},
+        const QuasiMonteCarloParameters &quasi_monte_carlo = QuasiMonteCarloParameters{}
+    );
+
+    [[nodiscard]] PortfolioReport price(const std::vector<PricingJob> &jobs) const;
+
+    [[nodiscard]] unsigned int size() const { return pool_->size(); }
+};
+
+#endif //OPTION_PRICING_PORTFOLIO_PRICER_H
@@ -0,0 +1,52 @@
+#ifndef OPTION_PRICING_PREPARED_OPTION_H
+#define OPTION_PRICING_PREPARED_OPTION_H
+
+#include "option.h"
+
+/**
+ * An Option bound to a rate and volatility, with every spot-independent Black-Scholes term
+ * precomputed for BlackScholesEngine::price(prepared, spot)
+ * - A spot tick then costs one log, the CDF pair, one PDF and a few FMAs
+ * - bind() recomputes the terms only if rate or volatility changed; the engine's
+ *   price(prepared, market) calls it, so stale terms are never used
+ */
+class PreparedOption {
+private:
+    Option option_;
+    double rate_;
+    double volatility_;
+
+    double omega_;                  // +1 call, -1 put
+    double log_strike_;
+    double drift_;                  // (r + sigma^2 / 2) T
+    double sqrt_expiry_;
+    double vol_sqrt_expiry_;
+    double inv_vol_sqrt_expiry_;
+    double discounted_strike_;      // K e^{-rT}
+    double theta_decay_;            // sigma / (2 sqrt(T))
+
+    // Validates, then binds rate and volatility and recomputes every term
+    void prepare(double rate, double volatility);
+
+public:
+    PreparedOption(const Option &option, double rate, double volatility);
+
+    // Re-prepares when rate or volatility differ from the bound ones, returns whether it did;
+    // throws on an invalid volatility and then keeps the previous binding
+    bool bind(double rate, double volatility);
+
+    [[nodiscard]] const Option &getOption() const { return option_; }
+    [[nodiscard]] double getRate() const { return rate_; }
+    [[nodiscard]] double getVolatility() const { return volatility_; }
+
+    [[nodiscard]] double omega() const { return omega_; }
+    [[nodiscard]] double logStrike() const { return log_strike_; }
+    [[nodiscard]] double drift() const { return drift_; }
+    [[nodiscard]] double sqrtExpiry() const { return sqrt_expiry_; }
+    [[nodiscard]] double volSqrtExpiry() const { return vol_sqrt_expiry_; }
+    [[nodiscard]] double invVolSqrtExpiry() const { return inv_vol_sqrt_expiry_; }
+    [[nodiscard]] double discountedStrike() const { return discounted_strike_; }
+    [[nodiscard]] double thetaDecay() const { return theta_decay_; }
+};
+
+#endif //OPTION_PRICING_PREPARED_OPTION_H
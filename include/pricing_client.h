@@ -0,0 +1,116 @@
+#ifndef OPTION_PRICING_PRICING_CLIENT_H
+#define OPTION_PRICING_PRICING_CLIENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "pricing_protocol.h"
+
+/**
+ * Blocking client of the pricing server, one Unix domain socket connection
+ * - Each call sends one request and waits for its response
+ * - An Error response throws std::invalid_argument with the server's message; a broken connection
+ *   throws std::runtime_error
+ * - Move-only; not safe to share between threads, open one client per thread
+ */
+class PricingClient {
+private:
+    int fd_{-1};
+    std::uint64_t next_id_{1};
+    std::vector<unsigned char> buffer_;
+
+    // Sends buffer_ and reads the matching response payload into buffer_
+    void exchange(std::uint64_t id);
+
+public:
+    explicit PricingClient(const std::string &socket_path);
+    ~PricingClient();
+
+    PricingClient(PricingClient &&other) noexcept;
+    PricingClient &operator=(PricingClient &&other) noexcept;
+    PricingClient(const PricingClient &) = delete;
+    PricingClient &operator=(const PricingClient &) = delete;
+
+    // results receives count records
+    void price(const PricingProtocol::WireOption *options, std::size_t count, PricingProtocol::Method method,
+               PricingProtocol::WireResult *results);
+
+    [[nodiscard]] std::vector<PricingProtocol::WireResult> price(
+        const std::vector<PricingProtocol::WireOption> &options,
+        PricingProtocol::Method method
+    );
+
+    [[nodiscard]] PricingProtocol::WireStatistics statistics();
+};
+
+struct LoadTestParameters {
+    std::string socket_path;
+    unsigned int connections;           // one client thread each
+    std::size_t requests;               // per connection, sent back to back
+    std::size_t options_per_request;
+    PricingProtocol::Method method;
+    unsigned int random_seed;
+
+    explicit LoadTestParameters(
+        std::string path,
+        const unsigned int clients = 4,
+        const std::size_t requests_per_connection = 1000,
+        const std::size_t options = 1,
+        const PricingProtocol::Method pricing_method = PricingProtocol::Method::BlackScholes,
+        const unsigned int seed = 42
+    ) : socket_path{std::move(path)}, connections{clients}, requests{requests_per_connection},
+        options_per_request{options}, method{pricing_method}, random_seed{seed} {
+        validate();
+    }
+
+    void validate() const {
+        if (socket_path.empty()) throw std::invalid_argument("Socket path must not be empty");
+        if (connections == 0) throw std::invalid_argument("Load test needs at least one connection");
+        if (requests == 0) throw std::invalid_argument("Load test needs at least one request");
+        if (options_per_request == 0 || options_per_request > PricingProtocol::MAX_REQUEST_OPTIONS) {
+            throw std::invalid_argument("Options per request must be between 1 and the protocol maximum");
+        }
+    }
+};
+
+struct LoadTestReport {
+    std::uint64_t requests{0};
+    std::uint64_t options{0};
+    double wall_seconds{0.0};
+    double mean_us{0.0};                // client-side round trips, exact percentiles
+    double p50_us{0.0};
+    double p99_us{0.0};
+    double max_us{0.0};
+    PricingProtocol::WireStatistics server{};   // server totals queried after the run
+
+    [[nodiscard]] double requestsPerSecond() const {
+        return wall_seconds > 0 ? static_cast<double>(requests) / wall_seconds : 0.0;
+    }
+
+    [[nodiscard]] double optionsPerSecond() const {
+        return wall_seconds > 0 ? static_cast<double>(options) / wall_seconds : 0.0;
+    }
+};
+
+/**
+ * Closed-loop load generator for a running pricing server
+ * - Every connection thread connects first, then all start together and send their requests back
+ *   to back, each waiting for the previous response
+ * - Options are drawn once per connection from a seeded generator (spot and strike 80-120, rate
+ *   1-5%, volatility 10-40%, expiry 0.1-2 years, calls and puts alternating) and reused in rotation
+ */
+class LoadGenerator {
+private:
+    LoadTestParameters parameters_;
+
+public:
+    explicit LoadGenerator(LoadTestParameters parameters);
+
+    [[nodiscard]] LoadTestReport run() const;
+};
+
+#endif //OPTION_PRICING_PRICING_CLIENT_H
@@ -4,6 +4,9 @@
 #include "option.h"
 #include "market_parameters.h"
 #include "pricing_result.h"
+#include "compact_pricing_result.h"
+#include "bump_scenario.h"
+#include <vector>
 
 class PricingEngine {
 public:
@@ -15,6 +18,40 @@ public:
     ) const = 0;
 
     virtual std::string getName() const = 0;
+
+    // Identifies the engine in CompactPricingResult
+    virtual EngineId engineId() const { return EngineId::Custom; }
+
+    /**
+     * Writes price and Greeks into a caller-owned compact result
+     * - Default: converts price(); engines with an allocation-free path override it
+     */
+    virtual void priceInto(
+        const Option& option,
+        const MarketParameters& market_parameters,
+        CompactPricingResult& out
+    ) const {
+        out = CompactPricingResult::fromPricingResult(price(option, market_parameters), engineId());
+    }
+
+    /**
+     * Prices every bump scenario, in order
+     * - Default: one independent price() per scenario
+     * - Simulation engines override this to evaluate all scenarios on the same random draws in
+     *   one sweep, so differences between scenarios carry no sampling noise of their own
+     */
+    virtual std::vector<double> priceScenarios(
+        const Option& option,
+        const MarketParameters& market_parameters,
+        const std::vector<BumpScenario>& scenarios
+    ) const {
+        std::vector<double> prices;
+        prices.reserve(scenarios.size());
+        for (const auto& scenario: scenarios) {
+            prices.push_back(price(scenario.apply(option), scenario.apply(market_parameters)).price);
+        }
+        return prices;
+    }
 };
 
 #endif //OPTION_PRICING_PRICING_ENGINE_H
\ No newline at end of file
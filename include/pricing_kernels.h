@@ -0,0 +1,177 @@
+#ifndef OPTION_PRICING_PRICING_KERNELS_H
+#define OPTION_PRICING_PRICING_KERNELS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "compact_pricing_result.h"
+#include "financial_math.h"
+#include "instrumentation.h"
+#include "option.h"
+
+/**
+ * Compile-time specialized pricing kernels
+ * - Kernels are templates on the option type, the Greek set and, for Black-Scholes, the CDF
+ *   accuracy tier: omega is a constant, Greeks outside the set are never computed, and nothing
+ *   in the hot loop branches on the type or calls through a vtable
+ * - The batch and path kernels are also templates on the floating-point type (Precision)
+ * - Engines select an instantiation once per batch or simulation block with the with*() helpers,
+ *   and per scalar call with a plain switch; their PricingEngine overrides stay as thin adapters
+ */
+namespace PricingKernels {
+    // Greek sets, as CompactPricingResult::greeks_mask bits
+    inline constexpr unsigned NO_GREEKS = 0;
+    inline constexpr unsigned DELTA_ONLY = 1u << static_cast<unsigned>(Greek::Delta);
+    inline constexpr unsigned ALL_GREEKS = CompactPricingResult::ALL_GREEKS;
+
+    template<unsigned Greeks>
+    [[nodiscard]] constexpr bool wants(const Greek greek) {
+        return ((Greeks >> static_cast<unsigned>(greek)) & 1u) != 0;
+    }
+
+    template<Precision P>
+    using Real = std::conditional_t<P == Precision::Single, float, double>;
+
+    template<Option::Type Type>
+    inline constexpr double omega = Type == Option::Type::CALL ? 1.0 : -1.0;
+
+    template<Option::Type Type>
+    [[nodiscard]] inline double payoff(const double spot, const double strike) {
+        if constexpr (Type == Option::Type::CALL) {
+            return std::max(spot - strike, 0.0);
+        } else {
+            return std::max(strike - spot, 0.0);
+        }
+    }
+
+    // Scalar normal CDF of a tier; Full keeps the std::erfc reference
+    template<CdfAccuracy Accuracy>
+    [[nodiscard]] inline double normalCDF(const double x) {
+        if constexpr (Accuracy == CdfAccuracy::Full) {
+            return FinancialMath::normalCDF(x);
+        } else {
+            return FinancialMath::normalCDF<Accuracy>(x);
+        }
+    }
+
+    /**
+     * Black-Scholes price and a Greek set from d1 and the spot-independent terms
+     * - price = omega (S N(omega d1) - K e^{-rT} N(omega d2)), Greeks in the units of
+     *   BlackScholesEngine::price (vega and rho per 1%, theta per day)
+     * - Greeks outside the set are left untouched and cleared from greeks_mask
+     */
+    template<Option::Type Type, unsigned Greeks, CdfAccuracy Accuracy>
+    inline void blackScholes(
+        const double spot,
+        const double d1,
+        const double vol_sqrt_expiry,
+        const double sqrt_expiry,
+        const double discounted_strike,
+        const double theta_decay,
+        const double rate,
+        const double expiry,
+        CompactPricingResult &out
+    ) {
+        constexpr double w = omega<Type>;
+        const double cdf_d1 = normalCDF<Accuracy>(w * d1);
+        const double cdf_d2 = normalCDF<Accuracy>(w * (d1 - vol_sqrt_expiry));
+
+        out.price = w * (spot * cdf_d1 - discounted_strike * cdf_d2);
+        out.standard_error = 0.0;
+        out.paths_used = 0;
+        out.greeks_mask = static_cast<std::uint8_t>(Greeks);
+        out.engine = EngineId::BlackScholes;
+
+        if constexpr (Greeks != NO_GREEKS) {
+            PRICING_SCOPE(Probe::BlackScholesGreeks);
+            const double phi_d1 = FinancialMath::normalPDF(d1);
+
+            if constexpr (wants<Greeks>(Greek::Delta)) out.delta = w * cdf_d1;
+            if constexpr (wants<Greeks>(Greek::Gamma)) out.gamma = phi_d1 / (spot * vol_sqrt_expiry);
+            if constexpr (wants<Greeks>(Greek::Vega)) out.vega = spot * phi_d1 * sqrt_expiry / 100.0;
+
+            // Theta time unit = days
+            if constexpr (wants<Greeks>(Greek::Theta)) {
+                out.theta = (-spot * phi_d1 * theta_decay - w * rate * discounted_strike * cdf_d2) / 365.0;
+            }
+            if constexpr (wants<Greeks>(Greek::Rho)) out.rho = w * discounted_strike * expiry * cdf_d2 / 100.0;
+        }
+    }
+
+    // Same, from market inputs
+    template<Option::Type Type, unsigned Greeks, CdfAccuracy Accuracy>
+    inline void blackScholes(
+        const double spot,
+        const double strike,
+        const double rate,
+        const double volatility,
+        const double expiry,
+        CompactPricingResult &out
+    ) {
+        const double sqrt_expiry = std::sqrt(expiry);
+        const double vol_sqrt_expiry = volatility * sqrt_expiry;
+        const double d1 = (std::log(spot / strike) + (rate + 0.5 * volatility * volatility) * expiry) / vol_sqrt_expiry;
+
+        blackScholes<Type, Greeks, Accuracy>(spot, d1, vol_sqrt_expiry, sqrt_expiry, strike * std::exp(-rate * expiry),
+                                             volatility / (2.0 * sqrt_expiry), rate, expiry, out);
+    }
+
+    // Option types present in a batch; uniform batches get an omega constant per kernel
+    enum class TypeMix {
+        Calls,
+        Puts,
+        Mixed
+    };
+
+    [[nodiscard]] inline TypeMix typeMix(const Option::Type *types, const std::size_t size) {
+        if (size == 0) return TypeMix::Calls;
+        const Option::Type first = types[0];
+        for (std::size_t i = 1; i < size; ++i) {
+            if (types[i] != first) return TypeMix::Mixed;
+        }
+        return first == Option::Type::CALL ? TypeMix::Calls : TypeMix::Puts;
+    }
+
+    // Runtime value -> compile-time constant: calls kernel(std::integral_constant<...>{})
+
+    template<typename Kernel>
+    decltype(auto) withType(const Option::Type type, Kernel &&kernel) {
+        if (type == Option::Type::CALL) return kernel(std::integral_constant<Option::Type, Option::Type::CALL>{});
+        return kernel(std::integral_constant<Option::Type, Option::Type::PUT>{});
+    }
+
+    template<typename Kernel>
+    decltype(auto) withTypeMix(const TypeMix mix, Kernel &&kernel) {
+        switch (mix) {
+            case TypeMix::Calls: return kernel(std::integral_constant<TypeMix, TypeMix::Calls>{});
+            case TypeMix::Puts: return kernel(std::integral_constant<TypeMix, TypeMix::Puts>{});
+            default: return kernel(std::integral_constant<TypeMix, TypeMix::Mixed>{});
+        }
+    }
+
+    template<typename Kernel>
+    decltype(auto) withAccuracy(const CdfAccuracy accuracy, Kernel &&kernel) {
+        switch (accuracy) {
+            case CdfAccuracy::High: return kernel(std::integral_constant<CdfAccuracy, CdfAccuracy::High>{});
+            case CdfAccuracy::Fast: return kernel(std::integral_constant<CdfAccuracy, CdfAccuracy::Fast>{});
+            default: return kernel(std::integral_constant<CdfAccuracy, CdfAccuracy::Full>{});
+        }
+    }
+
+    template<typename Kernel>
+    decltype(auto) withPrecision(const Precision precision, Kernel &&kernel) {
+        if (precision == Precision::Single) return kernel(std::integral_constant<Precision, Precision::Single>{});
+        return kernel(std::integral_constant<Precision, Precision::Double>{});
+    }
+
+    template<typename Kernel>
+    decltype(auto) withFlag(const bool flag, Kernel &&kernel) {
+        if (flag) return kernel(std::true_type{});
+        return kernel(std::false_type{});
+    }
+}
+
+#endif //OPTION_PRICING_PRICING_KERNELS_H
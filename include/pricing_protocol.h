@@ -0,0 +1,115 @@
+#ifndef OPTION_PRICING_PRICING_PROTOCOL_H
+#define OPTION_PRICING_PRICING_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Length-prefixed binary protocol of the pricing server
+ * - Every message is a frame: a uint32 payload length, then the payload
+ * - Integers and doubles are in host byte order; the transport is a Unix domain socket, so both
+ *   ends always run on the same machine
+ * - Request payload: RequestHeader, then `count` WireOption records (Price) or nothing (Stats)
+ * - Response payload: ResponseHeader echoing the request id, then `count` WireResult records
+ *   (Price), one WireStatistics (Stats), or `count` bytes of error text (status Error)
+ * - A connection may pipeline requests; responses carry the request id, and Price responses on one
+ *   connection keep its request order
+ */
+namespace PricingProtocol {
+    enum class RequestType : std::uint32_t {
+        Price = 1,
+        Stats = 2
+    };
+
+    enum class Method : std::uint32_t {
+        BlackScholes = 0,
+        MonteCarlo = 1
+    };
+
+    enum class Status : std::uint32_t {
+        Ok = 0,
+        Error = 1
+    };
+
+    // Requests above this are refused and the connection is closed
+    inline constexpr std::uint32_t MAX_REQUEST_OPTIONS = 1u << 20;
+
+    struct RequestHeader {
+        RequestType type;
+        Method method;
+        std::uint64_t id;           // chosen by the client, echoed in the response
+        std::uint32_t count;        // options that follow
+        std::uint32_t reserved;
+    };
+
+    struct WireOption {
+        double spot;
+        double strike;
+        double rate;
+        double volatility;
+        double expiry;
+        std::uint32_t type;         // 0 call, 1 put
+        std::uint32_t reserved;
+    };
+
+    struct ResponseHeader {
+        std::uint64_t id;
+        Status status;
+        std::uint32_t count;
+    };
+
+    // Standard error is NaN for Black-Scholes
+    struct WireResult {
+        double price;
+        double standard_error;
+        double delta;
+        double gamma;
+        double vega;
+        double theta;
+        double rho;
+    };
+
+    // Server-side latency is measured from a request's last byte received to its response sent
+    struct WireStatistics {
+        std::uint64_t requests;
+        std::uint64_t options;
+        std::uint64_t batches;
+        std::uint64_t errors;
+        double mean_batch_options;
+        double p50_us;              // percentiles from a log-linear histogram, within ~3%
+        double p99_us;
+        double max_us;
+    };
+
+    static_assert(sizeof(RequestHeader) == 24, "RequestHeader must match the wire layout");
+    static_assert(sizeof(WireOption) == 48, "WireOption must match the wire layout");
+    static_assert(sizeof(ResponseHeader) == 16, "ResponseHeader must match the wire layout");
+    static_assert(sizeof(WireResult) == 56, "WireResult must match the wire layout");
+    static_assert(sizeof(WireStatistics) == 64, "WireStatistics must match the wire layout");
+
+    // Reads exactly `bytes`; false on a clean end of stream before the first byte, throws on a short read
+    bool readExact(int fd, void *data, std::size_t bytes);
+
+    // Writes every byte, retrying short writes; never raises SIGPIPE
+    void writeAll(int fd, const void *data, std::size_t bytes);
+
+    // Reads one frame's payload into `payload`; false at end of stream, throws above max_bytes
+    bool readFrame(int fd, std::vector<unsigned char> &payload, std::size_t max_bytes);
+
+    // Appends a frame holding the concatenation of `parts` to `out`
+    void appendFrame(std::vector<unsigned char> &out, std::initializer_list<std::pair<const void *, std::size_t>> parts);
+
+    // Largest request payload the server accepts
+    [[nodiscard]] constexpr std::size_t maxRequestBytes() {
+        return sizeof(RequestHeader) + static_cast<std::size_t>(MAX_REQUEST_OPTIONS) * sizeof(WireOption);
+    }
+
+    // Empty when the option can be priced, otherwise the reason
+    [[nodiscard]] std::string validate(const WireOption &option);
+}
+
+#endif //OPTION_PRICING_PRICING_PROTOCOL_H
@@ -11,6 +11,8 @@ struct PricingResult {
     double price;
     std::optional<double> standard_error;
     std::optional<int> paths_used;
+    // Plain Monte Carlo variance over the variance achieved with the same number of paths
+    std::optional<double> variance_reduction_factor;
     Greeks greeks;
     std::string method_name;
 
@@ -0,0 +1,80 @@
+#ifndef OPTION_PRICING_PRICING_SERVER_H
+#define OPTION_PRICING_PRICING_SERVER_H
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "pricing_protocol.h"
+
+struct PricingServerParameters {
+    std::string socket_path;
+    double max_delay_us;            // how long the first request of a batch waits for others, 0 = no wait
+    std::size_t max_batch_options;  // a batch is priced early once this many options are waiting
+    unsigned int num_threads;       // pricing threads, 0 = every hardware thread
+    int num_paths;                  // Monte Carlo requests
+    unsigned int random_seed;
+
+    explicit PricingServerParameters(
+        std::string path,
+        const double delay_us = 200.0,
+        const unsigned int threads = 0,
+        const int paths = 100000,
+        const std::size_t batch_options = 65536,
+        const unsigned int seed = 42
+    ) : socket_path{std::move(path)}, max_delay_us{delay_us}, max_batch_options{batch_options},
+        num_threads{threads}, num_paths{paths}, random_seed{seed} {
+        validate();
+    }
+
+    void validate() const {
+        if (socket_path.empty()) throw std::invalid_argument("Socket path must not be empty");
+        if (!(max_delay_us >= 0)) throw std::invalid_argument("Maximum batching delay must be non-negative");
+        if (max_batch_options == 0) throw std::invalid_argument("Maximum batch size must be positive");
+        if (num_paths <= 0) throw std::invalid_argument("Number of paths must be positive");
+    }
+};
+
+/**
+ * Long-running pricing server on a Unix domain socket (see PricingProtocol)
+ * - Engines and the pricing thread pool are built once and stay warm for every request
+ * - One reader thread per connection decodes frames and queues Price requests; a single batcher
+ *   thread waits up to max_delay_us after the first queued request (or until max_batch_options are
+ *   waiting), then prices everything queued as one micro-batch per method with BatchPricer::price,
+ *   so concurrent small requests share SIMD batches and the thread pool
+ * - The batcher hands responses in queue order to a writer thread per connection, so a client
+ *   that stops reading only stalls itself and is dropped on its first timed-out write; invalid
+ *   Price requests are queued as rejected entries, so their error frames keep the connection's
+ *   request order; Stats requests are answered without waiting for the batcher
+ * - Latency percentiles cover every priced request since start, from its last byte received to its
+ *   response sent
+ * - run() blocks until stop(); stop() only sets a flag, so it is safe from a signal handler
+ */
+class PricingServer {
+private:
+    struct State;
+
+    PricingServerParameters parameters_;
+    std::unique_ptr<State> state_;
+
+public:
+    explicit PricingServer(const PricingServerParameters &parameters);
+    ~PricingServer();
+
+    PricingServer(const PricingServer &) = delete;
+    PricingServer &operator=(const PricingServer &) = delete;
+
+    // Binds the socket (replacing a stale socket file), serves until stop(), then removes the file
+    void run();
+
+    void stop();
+
+    // True once run() is accepting connections
+    [[nodiscard]] bool listening() const;
+
+    [[nodiscard]] PricingProtocol::WireStatistics statistics() const;
+};
+
+#endif //OPTION_PRICING_PRICING_SERVER_H
@@ -0,0 +1,73 @@
+#ifndef OPTION_PRICING_QUASI_MONTE_CARLO_H
+#define OPTION_PRICING_QUASI_MONTE_CARLO_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include "option.h"
+#include "pricing_engine.h"
+
+struct QuasiMonteCarloParameters {
+    int points_per_replicate;
+    int num_replicates;
+    unsigned int random_seed;
+
+    // Powers of two keep every replicate a balanced (0, m, 1)-net
+    explicit QuasiMonteCarloParameters(const int points = 16384, const int replicates = 16, const unsigned int seed = 42)
+        : points_per_replicate{points}, num_replicates{replicates}, random_seed{seed} {
+        validate();
+    }
+
+    void validate() const {
+        if (points_per_replicate <= 0) throw std::invalid_argument("Number of points must be positive");
+        if (num_replicates < 2) throw std::invalid_argument("At least two replicates are needed for an error estimate");
+    }
+};
+
+/**
+ * One dimension of the Sobol sequence with Matousek linear scrambling and a random digital shift
+ * - The first Sobol dimension uses direction numbers v_k = 2^(32-k) (the van der Corput sequence)
+ * - Scrambling multiplies every direction number by a random lower-triangular binary matrix with
+ *   unit diagonal, the digital shift XORs a random word; both keep the net property
+ * - Points are generated in Gray-code order, one XOR per point
+ */
+class ScrambledSobol {
+private:
+    std::array<std::uint32_t, 32> directions_;
+    std::uint32_t state_;
+    std::uint32_t index_;
+
+public:
+    ScrambledSobol(std::uint64_t seed, std::uint64_t replicate);
+
+    // Next point in (0, 1), never exactly 0 or 1
+    double next();
+};
+
+/**
+ * Randomized quasi-Monte Carlo for European options under geometric Brownian motion
+ * - Each replicate is an independently scrambled Sobol point set mapped to normals with
+ *   FinancialMath::normalQuantile (Acklam)
+ * - Price is the mean of the replicate estimates, standard error comes from their spread,
+ *   so it stays an honest error estimate despite the deterministic point structure
+ */
+class QuasiMonteCarloEngine : public PricingEngine {
+private:
+    QuasiMonteCarloParameters parameters_;
+
+public:
+    explicit QuasiMonteCarloEngine(const QuasiMonteCarloParameters &parameters = QuasiMonteCarloParameters{})
+        : parameters_{parameters} {}
+
+    [[nodiscard]] PricingResult price(
+        const Option &option,
+        const MarketParameters &market_parameters
+    ) const override;
+
+    [[nodiscard]] std::string getName() const override;
+
+    [[nodiscard]] EngineId engineId() const override { return EngineId::QuasiMonteCarlo; }
+};
+
+#endif //OPTION_PRICING_QUASI_MONTE_CARLO_H
@@ -0,0 +1,119 @@
+#ifndef OPTION_PRICING_RUNNING_STATISTICS_H
+#define OPTION_PRICING_RUNNING_STATISTICS_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Single-pass mean and variance in constant memory
+ * - add: Welford's update, no catastrophic cancellation from sum of squares
+ * - merge: Chan, Golub, LeVeque pairwise combination, so per-block or per-thread
+ *   accumulators can be folded together
+ */
+class RunningStatistics {
+private:
+    std::int64_t count_;
+    double mean_;
+    double m2_;
+
+public:
+    RunningStatistics() : count_{0}, mean_{0.0}, m2_{0.0} {}
+
+    void add(const double value) {
+        ++count_;
+        const double delta = value - mean_;
+        mean_ += delta / static_cast<double>(count_);
+        m2_ += delta * (value - mean_);
+    }
+
+    void merge(const RunningStatistics &other) {
+        if (other.count_ == 0) return;
+        if (count_ == 0) {
+            *this = other;
+            return;
+        }
+
+        const auto count_a = static_cast<double>(count_);
+        const auto count_b = static_cast<double>(other.count_);
+        const double total = count_a + count_b;
+        const double delta = other.mean_ - mean_;
+
+        mean_ += delta * count_b / total;
+        m2_ += other.m2_ + delta * delta * count_a * count_b / total;
+        count_ += other.count_;
+    }
+
+    [[nodiscard]] std::int64_t count() const { return count_; }
+    [[nodiscard]] double mean() const { return mean_; }
+
+    // Sample variance (n - 1 denominator)
+    [[nodiscard]] double variance() const {
+        return count_ > 1 ? m2_ / static_cast<double>(count_ - 1) : 0.0;
+    }
+
+    [[nodiscard]] double standardError() const {
+        return count_ > 0 ? std::sqrt(variance() / static_cast<double>(count_)) : 0.0;
+    }
+};
+
+/**
+ * Single-pass means, variances and covariance of a pair (x, y), mergeable like RunningStatistics
+ * - Used for control variates, where y is the control and its covariance with x sets the coefficient
+ */
+class RunningCovariance {
+private:
+    std::int64_t count_;
+    double mean_x_;
+    double mean_y_;
+    double m2_x_;
+    double m2_y_;
+    double c_xy_;
+
+public:
+    RunningCovariance() : count_{0}, mean_x_{0.0}, mean_y_{0.0}, m2_x_{0.0}, m2_y_{0.0}, c_xy_{0.0} {}
+
+    void add(const double x, const double y) {
+        ++count_;
+        const auto n = static_cast<double>(count_);
+        const double delta_x = x - mean_x_;
+        const double delta_y = y - mean_y_;
+        mean_x_ += delta_x / n;
+        mean_y_ += delta_y / n;
+        m2_x_ += delta_x * (x - mean_x_);
+        m2_y_ += delta_y * (y - mean_y_);
+        c_xy_ += delta_x * (y - mean_y_);
+    }
+
+    void merge(const RunningCovariance &other) {
+        if (other.count_ == 0) return;
+        if (count_ == 0) {
+            *this = other;
+            return;
+        }
+
+        const auto count_a = static_cast<double>(count_);
+        const auto count_b = static_cast<double>(other.count_);
+        const double total = count_a + count_b;
+        const double delta_x = other.mean_x_ - mean_x_;
+        const double delta_y = other.mean_y_ - mean_y_;
+        const double weight = count_a * count_b / total;
+
+        mean_x_ += delta_x * count_b / total;
+        mean_y_ += delta_y * count_b / total;
+        m2_x_ += other.m2_x_ + delta_x * delta_x * weight;
+        m2_y_ += other.m2_y_ + delta_y * delta_y * weight;
+        c_xy_ += other.c_xy_ + delta_x * delta_y * weight;
+        count_ += other.count_;
+    }
+
+    [[nodiscard]] std::int64_t count() const { return count_; }
+    [[nodiscard]] double meanX() const { return mean_x_; }
+    [[nodiscard]] double meanY() const { return mean_y_; }
+
+    // Sample (co)variances, n - 1 denominator
+    [[nodiscard]] double varianceX() const { return count_ > 1 ? m2_x_ / static_cast<double>(count_ - 1) : 0.0; }
+    [[nodiscard]] double varianceY() const { return count_ > 1 ? m2_y_ / static_cast<double>(count_ - 1) : 0.0; }
+    [[nodiscard]] double covariance() const { return count_ > 1 ? c_xy_ / static_cast<double>(count_ - 1) : 0.0; }
+};
+
+#endif //OPTION_PRICING_RUNNING_STATISTICS_H
@@ -0,0 +1,71 @@
+#ifndef OPTION_PRICING_SCENARIO_GRID_H
+#define OPTION_PRICING_SCENARIO_GRID_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "financial_math.h"
+#include "option_batch.h"
+#include "thread_pool.h"
+
+// Scenario axes, applied to every option of the book
+struct ScenarioAxes {
+    std::vector<double> spot_shifts;    // relative, S' = S (1 + shift)
+    std::vector<double> vol_shifts;     // absolute, sigma' = sigma + shift
+    std::vector<double> time_shifts;    // years elapsed, T' = T - shift; options with T' <= 0 pay intrinsic
+
+    [[nodiscard]] std::size_t size() const { return spot_shifts.size() * vol_shifts.size() * time_shifts.size(); }
+};
+
+// Dense portfolio P&L per scenario, spot index fastest
+class PnlCube {
+private:
+    std::size_t spots_;
+    std::size_t vols_;
+    std::size_t times_;
+    std::vector<double> values_;
+
+public:
+    PnlCube(const std::size_t spots, const std::size_t vols, const std::size_t times)
+        : spots_{spots}, vols_{vols}, times_{times}, values_(spots * vols * times, 0.0) {}
+
+    [[nodiscard]] double at(const std::size_t spot, const std::size_t vol, const std::size_t time) const {
+        return values_[(time * vols_ + vol) * spots_ + spot];
+    }
+
+    [[nodiscard]] std::size_t spots() const { return spots_; }
+    [[nodiscard]] std::size_t vols() const { return vols_; }
+    [[nodiscard]] std::size_t times() const { return times_; }
+
+    [[nodiscard]] const std::vector<double> &values() const { return values_; }
+    [[nodiscard]] std::vector<double> &values() { return values_; }
+};
+
+/**
+ * Black-Scholes P&L of a whole book over a spot x vol x time scenario grid
+ * - P&L = sum over options of quantity * (scenario value - base value)
+ * - The book is cut into tiles of TILE_OPTIONS; a tile's inputs, base values and per-time terms
+ *   are small padded struct-of-arrays buffers that stay in cache while every scenario runs over them
+ * - Shared terms are hoisted out of the inner loops: log(1 + spot shift) once per grid, the
+ *   remaining expiry, sqrt and discounted strike once per tile and time shift, d1's drift and
+ *   denominator once per vol shift, so each grid point costs the CDF pair and a few FMAs per option
+ * - Tiles run in parallel; each writes its own partial cube and the partials are summed in tile
+ *   order, so the cube is bit-identical for any thread count
+ */
+class ScenarioGridEngine {
+private:
+    CdfAccuracy cdf_accuracy_;
+    std::shared_ptr<ThreadPool> thread_pool_;
+
+public:
+    static constexpr std::size_t TILE_OPTIONS = 512;
+
+    // num_threads = 0 uses every hardware thread
+    explicit ScenarioGridEngine(unsigned int num_threads = 1, CdfAccuracy cdf_accuracy = CdfAccuracy::Full);
+
+    // quantities[i] is the position in option i; inputs must be positive and vol + every vol shift > 0
+    [[nodiscard]] PnlCube run(const OptionBatch &book, const double *quantities, const ScenarioAxes &axes) const;
+};
+
+#endif //OPTION_PRICING_SCENARIO_GRID_H
@@ -0,0 +1,646 @@
+#ifndef OPTION_PRICING_SIMD_H
+#define OPTION_PRICING_SIMD_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+// GCC 12 reports _mm512_undefined_pd() inside its own intrinsics as uninitialized (PR 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+/**
+ * Thin wrapper over the widest double-precision vector the target supports.
+ * - AVX-512: 8 lanes, AVX2: 4 lanes, otherwise a scalar fallback with 1 lane
+ * - FloatVec is the single-precision counterpart with twice the lanes; it loads from and stores
+ *   to double arrays as well, rounding on the way in and widening on the way out
+ * - The ISA is fixed at compile time (-march=native in Release builds)
+ * - exp/log are implemented on top of a few bit-level primitives so every width
+ *   runs the same algorithm and produces the same results
+ */
+namespace Simd {
+
+#if defined(__AVX512F__)
+
+struct DoubleMask {
+    __mmask8 bits;
+};
+
+struct DoubleVec {
+    static constexpr int width = 8;
+    __m512d v;
+
+    DoubleVec() = default;
+    DoubleVec(const __m512d x) : v{x} {}
+    DoubleVec(const double x) : v{_mm512_set1_pd(x)} {}
+
+    static DoubleVec load(const double *p) { return _mm512_loadu_pd(p); }
+    void store(double *p) const { _mm512_storeu_pd(p, v); }
+};
+
+inline DoubleVec operator+(const DoubleVec a, const DoubleVec b) { return _mm512_add_pd(a.v, b.v); }
+inline DoubleVec operator-(const DoubleVec a, const DoubleVec b) { return _mm512_sub_pd(a.v, b.v); }
+inline DoubleVec operator*(const DoubleVec a, const DoubleVec b) { return _mm512_mul_pd(a.v, b.v); }
+inline DoubleVec operator/(const DoubleVec a, const DoubleVec b) { return _mm512_div_pd(a.v, b.v); }
+inline DoubleVec operator-(const DoubleVec a) { return _mm512_sub_pd(_mm512_setzero_pd(), a.v); }
+
+inline DoubleMask operator<(const DoubleVec a, const DoubleVec b) { return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)}; }
+inline DoubleMask operator>(const DoubleVec a, const DoubleVec b) { return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ)}; }
+
+// a * b + c
+inline DoubleVec fma(const DoubleVec a, const DoubleVec b, const DoubleVec c) { return _mm512_fmadd_pd(a.v, b.v, c.v); }
+inline DoubleVec sqrt(const DoubleVec a) { return _mm512_sqrt_pd(a.v); }
+inline DoubleVec min(const DoubleVec a, const DoubleVec b) { return _mm512_min_pd(a.v, b.v); }
+inline DoubleVec max(const DoubleVec a, const DoubleVec b) { return _mm512_max_pd(a.v, b.v); }
+inline DoubleVec abs(const DoubleVec a) { return _mm512_abs_pd(a.v); }
+inline DoubleVec round(const DoubleVec a) { return _mm512_mask_roundscale_pd(a.v, 0xFF, a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+// mask ? a : b
+inline DoubleVec select(const DoubleMask mask, const DoubleVec a, const DoubleVec b) {
+    return _mm512_mask_blend_pd(mask.bits, b.v, a.v);
+}
+
+inline DoubleMask operator&(const DoubleMask a, const DoubleMask b) { return {static_cast<__mmask8>(a.bits & b.bits)}; }
+inline bool any(const DoubleMask mask) { return mask.bits != 0; }
+
+// 2^n for integral n in [-1022, 1023]
+inline DoubleVec pow2(const DoubleVec n) {
+    const __m512d one = _mm512_set1_pd(1.0);
+    return _mm512_mask_scalef_pd(one, 0xFF, one, n.v);
+}
+
+// floor(log2(x)) for positive normal x
+inline DoubleVec exponent(const DoubleVec x) { return _mm512_mask_getexp_pd(x.v, 0xFF, x.v); }
+
+// x / 2^exponent(x), in [1, 2)
+inline DoubleVec mantissa(const DoubleVec x) { return _mm512_mask_getmant_pd(x.v, 0xFF, x.v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+
+struct FloatMask {
+    __mmask16 bits;
+};
+
+struct FloatVec {
+    static constexpr int width = 16;
+    __m512 v;
+
+    FloatVec() = default;
+    FloatVec(const __m512 x) : v{x} {}
+    FloatVec(const float x) : v{_mm512_set1_ps(x)} {}
+
+    static FloatVec load(const float *p) { return _mm512_loadu_ps(p); }
+    void store(float *p) const { _mm512_storeu_ps(p, v); }
+
+    // width doubles rounded to float, and widened back
+    static FloatVec load(const double *p) {
+        const __m256 low = _mm512_cvtpd_ps(_mm512_loadu_pd(p));
+        const __m256 high = _mm512_cvtpd_ps(_mm512_loadu_pd(p + 8));
+        return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(low)), _mm256_castps_pd(high), 1));
+    }
+
+    void store(double *p) const {
+        _mm512_storeu_pd(p, _mm512_cvtps_pd(_mm512_castps512_ps256(v)));
+        _mm512_storeu_pd(p + 8, _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1))));
+    }
+};
+
+inline FloatVec operator+(const FloatVec a, const FloatVec b) { return _mm512_add_ps(a.v, b.v); }
+inline FloatVec operator-(const FloatVec a, const FloatVec b) { return _mm512_sub_ps(a.v, b.v); }
+inline FloatVec operator*(const FloatVec a, const FloatVec b) { return _mm512_mul_ps(a.v, b.v); }
+inline FloatVec operator/(const FloatVec a, const FloatVec b) { return _mm512_div_ps(a.v, b.v); }
+inline FloatVec operator-(const FloatVec a) { return _mm512_sub_ps(_mm512_setzero_ps(), a.v); }
+
+inline FloatMask operator<(const FloatVec a, const FloatVec b) { return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ)}; }
+inline FloatMask operator>(const FloatVec a, const FloatVec b) { return {_mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ)}; }
+
+inline FloatVec fma(const FloatVec a, const FloatVec b, const FloatVec c) { return _mm512_fmadd_ps(a.v, b.v, c.v); }
+inline FloatVec sqrt(const FloatVec a) { return _mm512_sqrt_ps(a.v); }
+inline FloatVec min(const FloatVec a, const FloatVec b) { return _mm512_min_ps(a.v, b.v); }
+inline FloatVec max(const FloatVec a, const FloatVec b) { return _mm512_max_ps(a.v, b.v); }
+inline FloatVec abs(const FloatVec a) { return _mm512_abs_ps(a.v); }
+inline FloatVec round(const FloatVec a) { return _mm512_mask_roundscale_ps(a.v, 0xFFFF, a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+inline FloatVec select(const FloatMask mask, const FloatVec a, const FloatVec b) {
+    return _mm512_mask_blend_ps(mask.bits, b.v, a.v);
+}
+
+inline FloatMask operator&(const FloatMask a, const FloatMask b) { return {static_cast<__mmask16>(a.bits & b.bits)}; }
+inline bool any(const FloatMask mask) { return mask.bits != 0; }
+
+// 2^n for integral n in [-126, 127]
+inline FloatVec pow2(const FloatVec n) {
+    const __m512 one = _mm512_set1_ps(1.0f);
+    return _mm512_mask_scalef_ps(one, 0xFFFF, one, n.v);
+}
+
+inline FloatVec exponent(const FloatVec x) { return _mm512_mask_getexp_ps(x.v, 0xFFFF, x.v); }
+inline FloatVec mantissa(const FloatVec x) { return _mm512_mask_getmant_ps(x.v, 0xFFFF, x.v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+
+#elif defined(__AVX2__)
+
+struct DoubleMask {
+    __m256d bits;
+};
+
+struct DoubleVec {
+    static constexpr int width = 4;
+    __m256d v;
+
+    DoubleVec() = default;
+    DoubleVec(const __m256d x) : v{x} {}
+    DoubleVec(const double x) : v{_mm256_set1_pd(x)} {}
+
+    static DoubleVec load(const double *p) { return _mm256_loadu_pd(p); }
+    void store(double *p) const { _mm256_storeu_pd(p, v); }
+};
+
+inline DoubleVec operator+(const DoubleVec a, const DoubleVec b) { return _mm256_add_pd(a.v, b.v); }
+inline DoubleVec operator-(const DoubleVec a, const DoubleVec b) { return _mm256_sub_pd(a.v, b.v); }
+inline DoubleVec operator*(const DoubleVec a, const DoubleVec b) { return _mm256_mul_pd(a.v, b.v); }
+inline DoubleVec operator/(const DoubleVec a, const DoubleVec b) { return _mm256_div_pd(a.v, b.v); }
+inline DoubleVec operator-(const DoubleVec a) { return _mm256_sub_pd(_mm256_setzero_pd(), a.v); }
+
+inline DoubleMask operator<(const DoubleVec a, const DoubleVec b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)}; }
+inline DoubleMask operator>(const DoubleVec a, const DoubleVec b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)}; }
+
+// a * b + c
+inline DoubleVec fma(const DoubleVec a, const DoubleVec b, const DoubleVec c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(a.v, b.v, c.v);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a.v, b.v), c.v);
+#endif
+}
+
+inline DoubleVec sqrt(const DoubleVec a) { return _mm256_sqrt_pd(a.v); }
+inline DoubleVec min(const DoubleVec a, const DoubleVec b) { return _mm256_min_pd(a.v, b.v); }
+inline DoubleVec max(const DoubleVec a, const DoubleVec b) { return _mm256_max_pd(a.v, b.v); }
+inline DoubleVec abs(const DoubleVec a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v); }
+inline DoubleVec round(const DoubleVec a) { return _mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+// mask ? a : b
+inline DoubleVec select(const DoubleMask mask, const DoubleVec a, const DoubleVec b) {
+    return _mm256_blendv_pd(b.v, a.v, mask.bits);
+}
+
+inline DoubleMask operator&(const DoubleMask a, const DoubleMask b) { return {_mm256_and_pd(a.bits, b.bits)}; }
+inline bool any(const DoubleMask mask) { return _mm256_movemask_pd(mask.bits) != 0; }
+
+// 2^n for integral n in [-1022, 1023]: place n + 1023 in the exponent field
+inline DoubleVec pow2(const DoubleVec n) {
+    const __m256d biased = _mm256_add_pd(n.v, _mm256_set1_pd(6755399441055744.0 + 1023.0));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(biased), 52));
+}
+
+// floor(log2(x)) for positive normal x
+inline DoubleVec exponent(const DoubleVec x) {
+    const __m256i biased = _mm256_srli_epi64(_mm256_castpd_si256(x.v), 52);
+    const __m256d as_double = _mm256_castsi256_pd(_mm256_or_si256(biased, _mm256_set1_epi64x(0x4330000000000000)));
+    return _mm256_sub_pd(as_double, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+}
+
+// x / 2^exponent(x), in [1, 2)
+inline DoubleVec mantissa(const DoubleVec x) {
+    const __m256i fraction = _mm256_and_si256(_mm256_castpd_si256(x.v), _mm256_set1_epi64x(0x000FFFFFFFFFFFFF));
+    return _mm256_castsi256_pd(_mm256_or_si256(fraction, _mm256_set1_epi64x(0x3FF0000000000000)));
+}
+
+struct FloatMask {
+    __m256 bits;
+};
+
+struct FloatVec {
+    static constexpr int width = 8;
+    __m256 v;
+
+    FloatVec() = default;
+    FloatVec(const __m256 x) : v{x} {}
+    FloatVec(const float x) : v{_mm256_set1_ps(x)} {}
+
+    static FloatVec load(const float *p) { return _mm256_loadu_ps(p); }
+    void store(float *p) const { _mm256_storeu_ps(p, v); }
+
+    // width doubles rounded to float, and widened back
+    static FloatVec load(const double *p) {
+        return _mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(p + 4)), _mm256_cvtpd_ps(_mm256_loadu_pd(p)));
+    }
+
+    void store(double *p) const {
+        _mm256_storeu_pd(p, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        _mm256_storeu_pd(p + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+};
+
+inline FloatVec operator+(const FloatVec a, const FloatVec b) { return _mm256_add_ps(a.v, b.v); }
+inline FloatVec operator-(const FloatVec a, const FloatVec b) { return _mm256_sub_ps(a.v, b.v); }
+inline FloatVec operator*(const FloatVec a, const FloatVec b) { return _mm256_mul_ps(a.v, b.v); }
+inline FloatVec operator/(const FloatVec a, const FloatVec b) { return _mm256_div_ps(a.v, b.v); }
+inline FloatVec operator-(const FloatVec a) { return _mm256_sub_ps(_mm256_setzero_ps(), a.v); }
+
+inline FloatMask operator<(const FloatVec a, const FloatVec b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+inline FloatMask operator>(const FloatVec a, const FloatVec b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+
+inline FloatVec fma(const FloatVec a, const FloatVec b, const FloatVec c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a.v, b.v, c.v);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v);
+#endif
+}
+
+inline FloatVec sqrt(const FloatVec a) { return _mm256_sqrt_ps(a.v); }
+inline FloatVec min(const FloatVec a, const FloatVec b) { return _mm256_min_ps(a.v, b.v); }
+inline FloatVec max(const FloatVec a, const FloatVec b) { return _mm256_max_ps(a.v, b.v); }
+inline FloatVec abs(const FloatVec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+inline FloatVec round(const FloatVec a) { return _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+inline FloatVec select(const FloatMask mask, const FloatVec a, const FloatVec b) {
+    return _mm256_blendv_ps(b.v, a.v, mask.bits);
+}
+
+inline FloatMask operator&(const FloatMask a, const FloatMask b) { return {_mm256_and_ps(a.bits, b.bits)}; }
+inline bool any(const FloatMask mask) { return _mm256_movemask_ps(mask.bits) != 0; }
+
+// 2^n for integral n in [-126, 127]: place n + 127 in the exponent field
+inline FloatVec pow2(const FloatVec n) {
+    const __m256 biased = _mm256_add_ps(n.v, _mm256_set1_ps(12582912.0f + 127.0f));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(biased), 23));
+}
+
+inline FloatVec exponent(const FloatVec x) {
+    const __m256i biased = _mm256_srli_epi32(_mm256_castps_si256(x.v), 23);
+    const __m256 as_float = _mm256_castsi256_ps(_mm256_or_si256(biased, _mm256_set1_epi32(0x4B000000)));
+    return _mm256_sub_ps(as_float, _mm256_set1_ps(8388608.0f + 127.0f));
+}
+
+inline FloatVec mantissa(const FloatVec x) {
+    const __m256i fraction = _mm256_and_si256(_mm256_castps_si256(x.v), _mm256_set1_epi32(0x007FFFFF));
+    return _mm256_castsi256_ps(_mm256_or_si256(fraction, _mm256_set1_epi32(0x3F800000)));
+}
+
+#else
+
+struct DoubleMask {
+    bool bits;
+};
+
+struct DoubleVec {
+    static constexpr int width = 1;
+    double v;
+
+    DoubleVec() = default;
+    DoubleVec(const double x) : v{x} {}
+
+    static DoubleVec load(const double *p) { return *p; }
+    void store(double *p) const { *p = v; }
+};
+
+inline DoubleVec operator+(const DoubleVec a, const DoubleVec b) { return a.v + b.v; }
+inline DoubleVec operator-(const DoubleVec a, const DoubleVec b) { return a.v - b.v; }
+inline DoubleVec operator*(const DoubleVec a, const DoubleVec b) { return a.v * b.v; }
+inline DoubleVec operator/(const DoubleVec a, const DoubleVec b) { return a.v / b.v; }
+inline DoubleVec operator-(const DoubleVec a) { return -a.v; }
+
+inline DoubleMask operator<(const DoubleVec a, const DoubleVec b) { return {a.v < b.v}; }
+inline DoubleMask operator>(const DoubleVec a, const DoubleVec b) { return {a.v > b.v}; }
+
+// a * b + c
+inline DoubleVec fma(const DoubleVec a, const DoubleVec b, const DoubleVec c) { return a.v * b.v + c.v; }
+inline DoubleVec sqrt(const DoubleVec a) { return std::sqrt(a.v); }
+inline DoubleVec min(const DoubleVec a, const DoubleVec b) { return a.v < b.v ? a.v : b.v; }
+inline DoubleVec max(const DoubleVec a, const DoubleVec b) { return a.v > b.v ? a.v : b.v; }
+inline DoubleVec abs(const DoubleVec a) { return std::fabs(a.v); }
+inline DoubleVec round(const DoubleVec a) { return std::nearbyint(a.v); }
+
+// mask ? a : b
+inline DoubleVec select(const DoubleMask mask, const DoubleVec a, const DoubleVec b) { return mask.bits ? a : b; }
+
+inline DoubleMask operator&(const DoubleMask a, const DoubleMask b) { return {a.bits && b.bits}; }
+inline bool any(const DoubleMask mask) { return mask.bits; }
+
+// 2^n for integral n in [-1022, 1023]
+inline DoubleVec pow2(const DoubleVec n) {
+    const std::uint64_t bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(n.v) + 1023) << 52;
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// floor(log2(x)) for positive normal x
+inline DoubleVec exponent(const DoubleVec x) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &x.v, sizeof(bits));
+    return static_cast<double>(static_cast<std::int64_t>(bits >> 52) - 1023);
+}
+
+// x / 2^exponent(x), in [1, 2)
+inline DoubleVec mantissa(const DoubleVec x) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &x.v, sizeof(bits));
+    bits = (bits & 0x000FFFFFFFFFFFFF) | 0x3FF0000000000000;
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+struct FloatMask {
+    bool bits;
+};
+
+struct FloatVec {
+    static constexpr int width = 1;
+    float v;
+
+    FloatVec() = default;
+    FloatVec(const float x) : v{x} {}
+
+    static FloatVec load(const float *p) { return *p; }
+    void store(float *p) const { *p = v; }
+
+    static FloatVec load(const double *p) { return static_cast<float>(*p); }
+    void store(double *p) const { *p = v; }
+};
+
+inline FloatVec operator+(const FloatVec a, const FloatVec b) { return a.v + b.v; }
+inline FloatVec operator-(const FloatVec a, const FloatVec b) { return a.v - b.v; }
+inline FloatVec operator*(const FloatVec a, const FloatVec b) { return a.v * b.v; }
+inline FloatVec operator/(const FloatVec a, const FloatVec b) { return a.v / b.v; }
+inline FloatVec operator-(const FloatVec a) { return -a.v; }
+
+inline FloatMask operator<(const FloatVec a, const FloatVec b) { return {a.v < b.v}; }
+inline FloatMask operator>(const FloatVec a, const FloatVec b) { return {a.v > b.v}; }
+
+inline FloatVec fma(const FloatVec a, const FloatVec b, const FloatVec c) { return a.v * b.v + c.v; }
+inline FloatVec sqrt(const FloatVec a) { return std::sqrt(a.v); }
+inline FloatVec min(const FloatVec a, const FloatVec b) { return a.v < b.v ? a.v : b.v; }
+inline FloatVec max(const FloatVec a, const FloatVec b) { return a.v > b.v ? a.v : b.v; }
+inline FloatVec abs(const FloatVec a) { return std::fabs(a.v); }
+inline FloatVec round(const FloatVec a) { return std::nearbyint(a.v); }
+
+inline FloatVec select(const FloatMask mask, const FloatVec a, const FloatVec b) { return mask.bits ? a : b; }
+
+inline FloatMask operator&(const FloatMask a, const FloatMask b) { return {a.bits && b.bits}; }
+inline bool any(const FloatMask mask) { return mask.bits; }
+
+// 2^n for integral n in [-126, 127]
+inline FloatVec pow2(const FloatVec n) {
+    const std::uint32_t bits = static_cast<std::uint32_t>(static_cast<std::int32_t>(n.v) + 127) << 23;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline FloatVec exponent(const FloatVec x) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &x.v, sizeof(bits));
+    return static_cast<float>(static_cast<std::int32_t>(bits >> 23) - 127);
+}
+
+inline FloatVec mantissa(const FloatVec x) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &x.v, sizeof(bits));
+    bits = (bits & 0x007FFFFF) | 0x3F800000;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+#endif
+
+// Scalar overloads so kernels can be written once for both double and DoubleVec
+// a * b + c, fused exactly when the vector fma is, so scalar results match the lanes
+inline double fma(const double a, const double b, const double c) {
+#if defined(__AVX512F__) || defined(__FMA__)
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+inline double abs(const double a) { return std::fabs(a); }
+inline double select(const bool mask, const double a, const double b) { return mask ? a : b; }
+inline double sqrt(const double a) { return std::sqrt(a); }
+inline double log(const double a) { return std::log(a); }
+inline double min(const double a, const double b) { return a < b ? a : b; }
+inline double max(const double a, const double b) { return a > b ? a : b; }
+inline double round(const double a) { return std::nearbyint(a); }
+inline bool any(const bool mask) { return mask; }
+
+// 2^n for integral n in [-1022, 1023]
+inline double pow2(const double n) {
+    const std::uint64_t bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(n) + 1023) << 52;
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/**
+ * e^x with Cody-Waite range reduction and a Taylor polynomial on |r| <= ln2 / 2
+ * - Degree 13 (default): relative error ~2e-16; lower degrees trade accuracy for speed
+ *   (10: ~3e-13, 7: ~5e-9)
+ * - Arguments are clamped to [-708, 709]
+ */
+template<int Degree = 13, typename T>
+inline T expTaylor(const T x) {
+    static_assert(Degree >= 1 && Degree <= 13, "Taylor degree must be in [1, 13]");
+    static constexpr double log2e = 1.4426950408889634;
+    static constexpr double ln2_hi = 6.93147180369123816490e-01;
+    static constexpr double ln2_lo = 1.90821492927058770002e-10;
+    static constexpr double inverse_factorials[14] = {
+        1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0, 1.0 / 120.0, 1.0 / 720.0, 1.0 / 5040.0,
+        1.0 / 40320.0, 1.0 / 362880.0, 1.0 / 3628800.0, 1.0 / 39916800.0, 1.0 / 479001600.0,
+        1.0 / 6227020800.0
+    };
+
+    const T clamped = min(max(x, T{-708.0}), T{709.0});
+    const T n = round(clamped * log2e);
+    T r = fma(n, T{-ln2_hi}, clamped);
+    r = fma(n, T{-ln2_lo}, r);
+
+    T p = inverse_factorials[Degree];
+    for (int k = Degree - 1; k >= 0; --k) {
+        p = fma(p, r, T{inverse_factorials[k]});
+    }
+
+    return p * pow2(n);
+}
+
+template<int Degree = 13>
+inline DoubleVec exp(const DoubleVec x) { return expTaylor<Degree>(x); }
+
+// The same kernel on one double, so scalar and vector callers get identical results per tier
+template<int Degree = 13>
+inline double exp(const double x) { return expTaylor<Degree>(x); }
+
+/**
+ * Natural log for positive normal x
+ * - x = m * 2^e with m in [sqrt(1/2), sqrt(2)), log(m) = 2 atanh((m - 1) / (m + 1))
+ * - Relative error: ~2e-16
+ */
+inline DoubleVec log(const DoubleVec x) {
+    static constexpr double sqrt2 = 1.4142135623730951;
+    static constexpr double ln2_hi = 6.93147180369123816490e-01;
+    static constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+    DoubleVec e = exponent(x);
+    DoubleVec m = mantissa(x);
+    const DoubleMask upper = m > sqrt2;
+    m = select(upper, m * 0.5, m);
+    e = select(upper, e + 1.0, e);
+
+    const DoubleVec s = (m - 1.0) / (m + 1.0);
+    const DoubleVec s2 = s * s;
+
+    DoubleVec p = 1.0 / 21.0;
+    p = fma(p, s2, 1.0 / 19.0);
+    p = fma(p, s2, 1.0 / 17.0);
+    p = fma(p, s2, 1.0 / 15.0);
+    p = fma(p, s2, 1.0 / 13.0);
+    p = fma(p, s2, 1.0 / 11.0);
+    p = fma(p, s2, 1.0 / 9.0);
+    p = fma(p, s2, 1.0 / 7.0);
+    p = fma(p, s2, 1.0 / 5.0);
+    p = fma(p, s2, 1.0 / 3.0);
+
+    const DoubleVec two_s = s + s;
+    const DoubleVec log_m = fma(two_s * s2, p, two_s);
+
+    return fma(e, ln2_hi, fma(e, ln2_lo, log_m));
+}
+
+/**
+ * Single-precision e^x, the same reduction with ln2 split for float
+ * - Degrees above 7 are capped, 7 is already at float resolution (relative error ~1e-7)
+ * - Arguments are clamped to [-87, 88]
+ */
+template<int Degree = 13>
+inline FloatVec exp(const FloatVec x) {
+    static_assert(Degree >= 1 && Degree <= 13, "Taylor degree must be in [1, 13]");
+    constexpr int degree = Degree < 7 ? Degree : 7;
+    static constexpr float log2e = 1.44269504f;
+    static constexpr float ln2_hi = 0.693359375f;
+    static constexpr float ln2_lo = -2.12194440e-4f;
+    static constexpr float inverse_factorials[8] = {
+        1.0f, 1.0f, 1.0f / 2.0f, 1.0f / 6.0f, 1.0f / 24.0f, 1.0f / 120.0f, 1.0f / 720.0f, 1.0f / 5040.0f
+    };
+
+    const FloatVec clamped = min(max(x, -87.0f), 88.0f);
+    const FloatVec n = round(clamped * log2e);
+    FloatVec r = fma(n, -ln2_hi, clamped);
+    r = fma(n, -ln2_lo, r);
+
+    FloatVec p = inverse_factorials[degree];
+    for (int k = degree - 1; k >= 0; --k) {
+        p = fma(p, r, inverse_factorials[k]);
+    }
+
+    return p * pow2(n);
+}
+
+// Single-precision natural log for positive normal x, the series stops at s^9 (relative error ~1e-7)
+inline FloatVec log(const FloatVec x) {
+    static constexpr float sqrt2 = 1.41421356f;
+    static constexpr float ln2_hi = 0.693359375f;
+    static constexpr float ln2_lo = -2.12194440e-4f;
+
+    FloatVec e = exponent(x);
+    FloatVec m = mantissa(x);
+    const FloatMask upper = m > sqrt2;
+    m = select(upper, m * 0.5f, m);
+    e = select(upper, e + 1.0f, e);
+
+    const FloatVec s = (m - 1.0f) / (m + 1.0f);
+    const FloatVec s2 = s * s;
+
+    FloatVec p = 1.0f / 9.0f;
+    p = fma(p, s2, 1.0f / 7.0f);
+    p = fma(p, s2, 1.0f / 5.0f);
+    p = fma(p, s2, 1.0f / 3.0f);
+
+    const FloatVec two_s = s + s;
+    const FloatVec log_m = fma(two_s * s2, p, two_s);
+
+    return fma(e, ln2_hi, fma(e, ln2_lo, log_m));
+}
+
+/**
+ * sin(2 pi u) and cos(2 pi u) in single precision, u in turns
+ * - u is reduced by its nearest quarter turn q to |2 pi (u - q / 4)| <= pi / 4, where Taylor
+ *   polynomials of degree 9 and 8 are good to ~3e-8; q then swaps and negates the pair
+ * - Quarter turns are counted in [0, 4], so u must lie in [0, 1]
+ */
+inline void sinCosTurns(const FloatVec u, FloatVec &sine, FloatVec &cosine) {
+    static constexpr float two_pi = 6.28318531f;
+
+    const FloatVec quarter = round(u * 4.0f);
+    const FloatVec x = (u - quarter * 0.25f) * two_pi;
+    const FloatVec x2 = x * x;
+
+    FloatVec s = 1.0f / 362880.0f;
+    s = fma(s, x2, -1.0f / 5040.0f);
+    s = fma(s, x2, 1.0f / 120.0f);
+    s = fma(s, x2, -1.0f / 6.0f);
+    s = fma(s, x2, 1.0f);
+    s = s * x;
+
+    FloatVec c = 1.0f / 40320.0f;
+    c = fma(c, x2, -1.0f / 720.0f);
+    c = fma(c, x2, 1.0f / 24.0f);
+    c = fma(c, x2, -0.5f);
+    c = fma(c, x2, 1.0f);
+
+    // sin(x + q pi / 2), cos(x + q pi / 2) for q = 0..3 (4 wraps to 0)
+    const FloatVec half = quarter * 0.5f;
+    const FloatMask odd = abs(half - round(half)) > 0.25f;
+    const FloatMask negate_sine = (quarter > 1.5f) & (FloatVec(3.5f) > quarter);
+    const FloatMask negate_cosine = (quarter > 0.5f) & (FloatVec(2.5f) > quarter);
+
+    const FloatVec swapped_sine = select(odd, c, s);
+    const FloatVec swapped_cosine = select(odd, s, c);
+    sine = select(negate_sine, -swapped_sine, swapped_sine);
+    cosine = select(negate_cosine, -swapped_cosine, swapped_cosine);
+}
+
+// Vector type of a scalar type
+template<typename Real>
+using VectorOf = std::conditional_t<std::is_same_v<Real, float>, FloatVec, DoubleVec>;
+
+// Loads count <= width elements, the remaining lanes hold padding
+template<typename Vec = DoubleVec, typename Scalar>
+inline Vec loadPartial(const Scalar *source, const std::size_t count, const Scalar padding) {
+    if (count == Vec::width) return Vec::load(source);
+
+    Scalar buffer[Vec::width];
+    for (std::size_t lane = 0; lane < Vec::width; ++lane) {
+        buffer[lane] = lane < count ? source[lane] : padding;
+    }
+    return Vec::load(buffer);
+}
+
+// Stores the first count <= width lanes
+template<typename Vec, typename Scalar>
+inline void storePartial(const Vec value, Scalar *destination, const std::size_t count) {
+    if (count == Vec::width) {
+        value.store(destination);
+        return;
+    }
+
+    // With one lane count is 0 here; skipping the copy keeps GCC from flagging it as out of bounds
+    if constexpr (Vec::width > 1) {
+        Scalar buffer[Vec::width];
+        value.store(buffer);
+        std::memcpy(destination, buffer, count * sizeof(Scalar));
+    }
+}
+
+}
+
+#endif //OPTION_PRICING_SIMD_H
@@ -0,0 +1,56 @@
+#ifndef OPTION_PRICING_THREAD_POOL_H
+#define OPTION_PRICING_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed set of worker threads for data-parallel loops
+ * - parallelFor hands out indices dynamically, the calling thread works too
+ * - Concurrent parallelFor calls on the same pool are serialized, so a task must not
+ *   call parallelFor on the pool that runs it
+ * - The first exception thrown by a task is rethrown to the caller
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+
+    std::mutex submit_mutex_;
+    std::mutex state_mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+
+    const std::function<void(std::size_t)> *task_;
+    std::size_t task_count_;
+    std::atomic<std::size_t> next_index_;
+    unsigned int active_workers_;
+    std::size_t generation_;
+    std::exception_ptr error_;
+    bool stopping_;
+
+    void workerLoop();
+    void drain();
+
+public:
+    // num_threads counts the calling thread, 0 uses every hardware thread
+    explicit ThreadPool(unsigned int num_threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Runs task(i) for every i in [0, count) and returns once all of them finished
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)> &task);
+
+    [[nodiscard]] unsigned int size() const { return static_cast<unsigned int>(workers_.size()) + 1; }
+
+    static unsigned int hardwareThreads();
+};
+
+#endif //OPTION_PRICING_THREAD_POOL_H
@@ -5,7 +5,8 @@
 
 class Timer {
 private:
-    using Clock = std::chrono::high_resolution_clock;
+    // Monotonic, so measurements never jump with wall-clock adjustments
+    using Clock = std::chrono::steady_clock;
     using TimePoint = Clock::time_point;
 
     TimePoint start_time_;
@@ -19,17 +20,18 @@ public:
         is_running_ = true;
     }
 
-    // returns elapsed microseconds
-    [[nodiscard]] double elapsed() const {
+    [[nodiscard]] double elapsedNanoseconds() const {
         if (!is_running_) return 0.0;
 
-        const auto end_time = Clock::now();
-        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
-            end_time - start_time_
-        );
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time_);
         return static_cast<double>(duration.count());
     }
 
+    // returns elapsed microseconds, with nanosecond resolution
+    [[nodiscard]] double elapsed() const {
+        return elapsedNanoseconds() / 1000.0;
+    }
+
     double stop() {
         const double elapsed_time = elapsed();
         is_running_ = false;
@@ -37,12 +39,12 @@ public:
     }
 
     [[nodiscard]] double elapsedMilliseconds() const {
-        return elapsed() / 1000.0;
+        return elapsedNanoseconds() / 1000000.0;
     }
 
     [[nodiscard]] double elapsedSeconds() const {
-        return elapsed() / 1000000.0;
+        return elapsedNanoseconds() / 1000000000.0;
     }
 };
 
-#endif //OPTION_PRICING_TIMER_H
\ No newline at end of file
+#endif //OPTION_PRICING_TIMER_H
@@ -0,0 +1,65 @@
+#ifndef OPTION_PRICING_WORK_STEALING_POOL_H
+#define OPTION_PRICING_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class TaskPriority {
+    High,   // short tasks that must not wait behind long ones
+    Normal
+};
+
+/**
+ * Worker threads with one task deque each, for many independent tasks of uneven size
+ * - A worker takes high-priority tasks first (shared FIFO), then pops its own deque from the back
+ *   (most recent, cache-warm work), then steals from the front of the other workers' deques
+ * - Tasks receive the index of the worker running them, so callers can keep per-worker state
+ * - Tasks submitted from a worker go to that worker's deque, others are spread round-robin
+ * - Tasks must not throw; report errors through the task's own state
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void(unsigned int worker)>;
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex high_mutex_;
+    std::deque<Task> high_tasks_;
+
+    std::mutex state_mutex_;
+    std::condition_variable work_ready_;
+    std::atomic<long> queued_;
+    std::atomic<unsigned int> next_queue_;
+    bool stopping_;
+
+    void workerLoop(unsigned int worker);
+    bool tryPop(unsigned int worker, Task &task);
+    bool trySteal(unsigned int worker, Task &task);
+
+public:
+    // num_threads = 0 uses every hardware thread
+    explicit WorkStealingPool(unsigned int num_threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    void submit(Task task, TaskPriority priority = TaskPriority::Normal);
+
+    [[nodiscard]] unsigned int size() const { return static_cast<unsigned int>(workers_.size()); }
+};
+
+#endif //OPTION_PRICING_WORK_STEALING_POOL_H
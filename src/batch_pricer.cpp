@@ -0,0 +1,362 @@
+#include "batch_pricer.h"
+#include "black_scholes.h"
+#include "columnar_file.h"
+#include "csv_book.h"
+#include "monte_carlo.h"
+#include "option_batch.h"
+#include "thread_pool.h"
+#include "timer.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Options per priceBatch call when a chunk is split over the pool
+    constexpr std::size_t batch_slice = 4096;
+
+    // row + seven shortest-representation doubles + separators always fit
+    constexpr std::size_t max_row_bytes = 24 + 7 * 32;
+
+    constexpr std::string_view output_header = "row,price,std_error,delta,gamma,vega,theta,rho\n";
+
+    // Struct-of-arrays inputs and outputs for chunk_options rows, reused for the whole run
+    struct Chunk {
+        std::size_t size{0};
+        std::vector<std::uint64_t> line;
+        std::vector<double> spot;
+        std::vector<double> strike;
+        std::vector<double> rate;
+        std::vector<double> volatility;
+        std::vector<double> expiry;
+        std::vector<Option::Type> type;
+
+        std::vector<double> price;
+        std::vector<double> standard_error;
+        std::vector<double> delta;
+        std::vector<double> gamma;
+        std::vector<double> vega;
+        std::vector<double> theta;
+        std::vector<double> rho;
+
+        std::vector<char> text;
+
+        [[nodiscard]] OptionBatch book() const {
+            return OptionBatch{
+                strike.data(), expiry.data(), type.data(), spot.data(), rate.data(), volatility.data(), size
+            };
+        }
+
+        [[nodiscard]] BatchResults results() {
+            return BatchResults{price.data(), delta.data(), gamma.data(), vega.data(), theta.data(), rho.data()};
+        }
+
+        explicit Chunk(const std::size_t capacity)
+            : line(capacity), spot(capacity), strike(capacity), rate(capacity), volatility(capacity),
+              expiry(capacity), type(capacity), price(capacity), standard_error(capacity), delta(capacity),
+              gamma(capacity), vega(capacity), theta(capacity), rho(capacity), text(capacity * max_row_bytes) {}
+    };
+
+    using ChunkPtr = std::unique_ptr<Chunk>;
+
+    // Blocking hand-off between stages; close() lets the consumer drain what is left
+    class ChunkQueue {
+    private:
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::deque<ChunkPtr> chunks_;
+        bool closed_{false};
+
+    public:
+        void push(ChunkPtr chunk) {
+            {
+                const std::lock_guard lock{mutex_};
+                chunks_.push_back(std::move(chunk));
+            }
+            ready_.notify_one();
+        }
+
+        // False once closed and empty
+        bool pop(ChunkPtr &chunk) {
+            std::unique_lock lock{mutex_};
+            ready_.wait(lock, [this] { return closed_ || !chunks_.empty(); });
+            if (chunks_.empty()) return false;
+            chunk = std::move(chunks_.front());
+            chunks_.pop_front();
+            return true;
+        }
+
+        void close() {
+            {
+                const std::lock_guard lock{mutex_};
+                closed_ = true;
+            }
+            ready_.notify_all();
+        }
+    };
+
+    // Fills chunk from the reader; false at end of input with nothing read
+    bool parseChunk(CsvBookReader &reader, Chunk &chunk) {
+        chunk.size = 0;
+        CsvOptionRow row;
+
+        while (chunk.size < chunk.spot.size() && reader.next(row)) {
+            const std::size_t i = chunk.size++;
+            chunk.line[i] = row.line;
+            chunk.spot[i] = row.spot;
+            chunk.strike[i] = row.strike;
+            chunk.rate[i] = row.rate;
+            chunk.volatility[i] = row.volatility;
+            chunk.expiry[i] = row.expiry;
+            chunk.type[i] = row.type;
+        }
+        return chunk.size > 0;
+    }
+
+    char *appendNumber(char *out, char *const end, const double value) {
+        return std::to_chars(out, end, value).ptr;
+    }
+
+    // Formats a priced chunk into its text buffer, returns the byte count
+    std::size_t formatChunk(Chunk &chunk, const bool has_standard_error) {
+        char *out = chunk.text.data();
+        char *const end = out + chunk.text.size();
+
+        for (std::size_t i = 0; i < chunk.size; ++i) {
+            out = std::to_chars(out, end, chunk.line[i]).ptr;
+            *out++ = ',';
+            out = appendNumber(out, end, chunk.price[i]);
+            *out++ = ',';
+            if (has_standard_error) out = appendNumber(out, end, chunk.standard_error[i]);
+            for (const std::vector<double> *greek: {&chunk.delta, &chunk.gamma, &chunk.vega, &chunk.theta, &chunk.rho}) {
+                *out++ = ',';
+                out = appendNumber(out, end, (*greek)[i]);
+            }
+            *out++ = '\n';
+        }
+        return static_cast<std::size_t>(out - chunk.text.data());
+    }
+
+    // SIMD batches over slices of the book, spread over the pool
+    void priceBlackScholes(const OptionBatch &book, const BatchResults &results, const Precision precision, ThreadPool *pool) {
+        static const BlackScholesEngine engine;
+        const std::size_t slices = (book.size + batch_slice - 1) / batch_slice;
+
+        const auto price_slice = [&](const std::size_t slice) {
+            const std::size_t offset = slice * batch_slice;
+            const OptionBatch batch{
+                book.strike + offset, book.expiry + offset, book.type + offset,
+                book.spot + offset, book.rate + offset, book.volatility + offset,
+                std::min(batch_slice, book.size - offset)
+            };
+            engine.priceBatch(batch, BatchResults{
+                results.price + offset, results.delta + offset, results.gamma + offset,
+                results.vega + offset, results.theta + offset, results.rho + offset
+            }, precision);
+        };
+
+        if (pool) {
+            pool->parallelFor(slices, price_slice);
+        } else {
+            for (std::size_t slice = 0; slice < slices; ++slice) price_slice(slice);
+        }
+    }
+
+    // One single-threaded simulation per option, spread over the pool
+    void priceMonteCarlo(
+        const OptionBatch &book,
+        const BatchResults &results,
+        double *standard_error,
+        const MonteCarloEngine &engine,
+        ThreadPool *pool
+    ) {
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+        const auto price_option = [&](const std::size_t i) {
+            const Option option{book.strike[i], book.type[i], book.expiry[i]};
+            const MarketParameters market{book.spot[i], book.rate[i], book.volatility[i]};
+            const PricingResult result = engine.price(option, market);
+
+            results.price[i] = result.price;
+            standard_error[i] = result.standard_error.value_or(nan);
+            results.delta[i] = result.greeks.delta.value_or(nan);
+            results.gamma[i] = result.greeks.gamma.value_or(nan);
+            results.vega[i] = result.greeks.vega.value_or(nan);
+            results.theta[i] = result.greeks.theta.value_or(nan);
+            results.rho[i] = result.greeks.rho.value_or(nan);
+        };
+
+        if (pool) {
+            pool->parallelFor(book.size, price_option);
+        } else {
+            for (std::size_t i = 0; i < book.size; ++i) price_option(i);
+        }
+    }
+
+    // First failure of any stage; closing every queue unblocks the others
+    struct PipelineError {
+        std::mutex mutex;
+        std::exception_ptr error;
+        std::atomic<bool> failed{false};
+
+        void set(ChunkQueue &free_chunks, ChunkQueue &parsed, ChunkQueue &priced) {
+            {
+                const std::lock_guard lock{mutex};
+                if (!error) error = std::current_exception();
+            }
+            failed.store(true);
+            free_chunks.close();
+            parsed.close();
+            priced.close();
+        }
+    };
+}
+
+BatchPricer::BatchPricer(const BatchPricerParameters &parameters)
+    : parameters_{parameters} {
+    parameters_.validate();
+
+    // Options are spread over the pool, so each simulation runs on one thread
+    if (parameters_.method == BatchMethod::MonteCarlo) {
+        SimulationParameters simulation{parameters_.num_paths, parameters_.random_seed, 1};
+        simulation.precision = parameters_.precision;
+        mc_engine_ = std::make_shared<const MonteCarloEngine>(simulation);
+    }
+}
+
+std::unique_ptr<ThreadPool> BatchPricer::makePool() const {
+    const unsigned int threads = parameters_.num_threads == 0 ? ThreadPool::hardwareThreads() : parameters_.num_threads;
+    return threads > 1 ? std::make_unique<ThreadPool>(threads) : nullptr;
+}
+
+void BatchPricer::price(
+    const OptionBatch &book,
+    const BatchResults &results,
+    double *standard_error,
+    ThreadPool *pool
+) const {
+    if (mc_engine_) {
+        priceMonteCarlo(book, results, standard_error, *mc_engine_, pool);
+    } else {
+        priceBlackScholes(book, results, parameters_.precision, pool);
+    }
+}
+
+BatchPricingReport BatchPricer::priceBook(const std::string &book_path, const std::string &results_path) const {
+    BatchPricingReport report;
+    Timer timer;
+    timer.start();
+
+    const std::unique_ptr<ThreadPool> pool = makePool();
+    const ColumnarFile book_file = ColumnarFile::open(book_path);
+    const OptionBatch book = book_file.bookView();
+    ColumnarFile results_file = ColumnarFile::create(results_path, ColumnarKind::Results, book.size);
+    const BatchResults results = results_file.resultsView();
+    report.parse_seconds = timer.elapsedSeconds();
+
+    const double price_start = timer.elapsedSeconds();
+    price(book, results, static_cast<double *>(results_file.mutableColumn(ColumnId::StandardError)), pool.get());
+    report.price_seconds = timer.elapsedSeconds() - price_start;
+
+    report.options = book.size;
+    report.bytes_read = book_file.bytes();
+    report.bytes_written = results_file.bytes();
+    report.wall_seconds = timer.elapsedSeconds();
+    return report;
+}
+
+BatchPricingReport BatchPricer::run(std::FILE *input, std::FILE *output) const {
+    BatchPricingReport report;
+    Timer wall_timer;
+    wall_timer.start();
+
+    const std::unique_ptr<ThreadPool> pool = makePool();
+    const bool monte_carlo = parameters_.method == BatchMethod::MonteCarlo;
+
+    ChunkQueue free_chunks;
+    ChunkQueue parsed;
+    ChunkQueue priced;
+    PipelineError pipeline_error;
+
+    for (std::size_t i = 0; i < parameters_.chunks_in_flight; ++i) {
+        free_chunks.push(std::make_unique<Chunk>(parameters_.chunk_options));
+    }
+
+    std::thread reader{[&] {
+        try {
+            CsvBookReader book{input};
+            Timer timer;
+
+            ChunkPtr chunk;
+            while (!pipeline_error.failed.load() && free_chunks.pop(chunk)) {
+                timer.start();
+                const bool has_rows = parseChunk(book, *chunk);
+                report.parse_seconds += timer.stop() / 1e6;
+
+                if (!has_rows) break;
+                report.options += chunk->size;
+                parsed.push(std::move(chunk));
+            }
+            report.bytes_read = book.bytesRead();
+            parsed.close();
+        } catch (...) {
+            pipeline_error.set(free_chunks, parsed, priced);
+        }
+    }};
+
+    std::thread writer{[&] {
+        try {
+            if (std::fwrite(output_header.data(), 1, output_header.size(), output) != output_header.size()) {
+                throw std::runtime_error("Failed writing batch output");
+            }
+            report.bytes_written += output_header.size();
+            Timer timer;
+
+            ChunkPtr chunk;
+            while (!pipeline_error.failed.load() && priced.pop(chunk)) {
+                timer.start();
+                const std::size_t bytes = formatChunk(*chunk, monte_carlo);
+                if (std::fwrite(chunk->text.data(), 1, bytes, output) != bytes) {
+                    throw std::runtime_error("Failed writing batch output");
+                }
+                report.format_seconds += timer.stop() / 1e6;
+                report.bytes_written += bytes;
+                free_chunks.push(std::move(chunk));
+            }
+            if (std::fflush(output) != 0) throw std::runtime_error("Failed writing batch output");
+        } catch (...) {
+            pipeline_error.set(free_chunks, parsed, priced);
+        }
+    }};
+
+    try {
+        Timer timer;
+        ChunkPtr chunk;
+        while (!pipeline_error.failed.load() && parsed.pop(chunk)) {
+            timer.start();
+            price(chunk->book(), chunk->results(), chunk->standard_error.data(), pool.get());
+            report.price_seconds += timer.stop() / 1e6;
+            priced.push(std::move(chunk));
+        }
+        priced.close();
+    } catch (...) {
+        pipeline_error.set(free_chunks, parsed, priced);
+    }
+
+    reader.join();
+    writer.join();
+    if (pipeline_error.error) std::rethrow_exception(pipeline_error.error);
+
+    report.wall_seconds = wall_timer.elapsedSeconds();
+    return report;
+}
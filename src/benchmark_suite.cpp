@@ -1,14 +1,44 @@
 #include <iostream>
 #include <iomanip>
+#include <fstream>
 #include <sstream>
 #include <vector>
 #include <string>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <filesystem>
 #include "benchmark.h"
+#include "financial_math.h"
 #include "option.h"
 #include "market_parameters.h"
 #include "black_scholes.h"
 #include "monte_carlo.h"
+#include "quasi_monte_carlo.h"
 #include "discrete_greeks.h"
+#include "thread_pool.h"
+#include "portfolio_pricer.h"
+#include "implied_volatility.h"
+#include "path_simulation.h"
+#include "lattice.h"
+#include "pde.h"
+#include "cached_pricing_engine.h"
+#include "scenario_grid.h"
+#include "instrumentation.h"
+#include "batch_pricer.h"
+#include "columnar_file.h"
+#include "pricing_client.h"
+#include "pricing_server.h"
+#include "pricing_kernels.h"
+#include <chrono>
+#include <thread>
 
 namespace BenchmarkConfig {
     // Test parameters
@@ -23,12 +53,117 @@ namespace BenchmarkConfig {
     constexpr int BS_ITERATIONS{1000};
     constexpr int MC_ITERATIONS{10};
     constexpr int GREEKS_ITERATIONS{5};
+    constexpr int BATCH_ITERATIONS{10};
+
+    // Option book size for batch pricing
+    constexpr std::size_t BATCH_SIZE{100000};
+
+    // Spot ticks per timing run for prepared-option repricing
+    constexpr int SPOT_TICKS{1000000};
+
+    // Normal CDF accuracy grid over [-CDF_RANGE, CDF_RANGE] and timing workload
+    constexpr double CDF_RANGE{40.0};
+    constexpr std::size_t CDF_ACCURACY_POINTS{1600000};
+    constexpr std::size_t CDF_TIMING_POINTS{65536};
+    constexpr int CDF_ITERATIONS{200};
+
+    // Implied volatility: book size, timing repetitions, and the time value (fraction of spot)
+    // below which a quote carries too few digits to count towards the accuracy column
+    constexpr std::size_t IV_BOOK_SIZE{100000};
+    constexpr int IV_ITERATIONS{5};
+    constexpr double IV_MIN_TIME_VALUE{1e-8};
+
+    // Path-dependent options: monitoring steps per year, paths per pricing, barrier levels
+    const std::vector PATH_STEPS = {12, 52, 252};
+    constexpr int PATH_PATHS{100000};
+    constexpr int PATH_ITERATIONS{3};
+    constexpr double DOWN_BARRIER{90.0};
+    constexpr double UP_BARRIER{130.0};
+
+    // Lattices: step counts and timing repetitions per pricing
+    const std::vector LATTICE_STEPS = {100, 1000, 5000};
+    constexpr int LATTICE_ITERATIONS{20};
+
+    // PDE: time steps per solve (space steps are twice as many), grid of strikes (% of spot) x expiries
+    const std::vector PDE_TIME_STEPS = {100, 200, 400};
+    constexpr int PDE_ITERATIONS{10};
+    const std::vector PDE_GRID_EXPIRIES = {0.25, 0.5, 1.0, 2.0};
+    constexpr int PDE_GRID_STRIKES{25};
+    constexpr int PDE_REFERENCE_STEPS{20001};
+
+    // Risk grid: spot steps of 1%, vol steps of 1 point, elapsed days; book size and nested-loop sample
+    constexpr int GRID_SPOT_STEPS{10};          // -10% .. +10%
+    constexpr int GRID_VOL_STEPS{5};            // -5 .. +5 vol points
+    const std::vector GRID_ELAPSED_DAYS = {0.0, 1.0, 7.0, 30.0, 90.0};
+    constexpr std::size_t GRID_BOOK_SIZE{20000};
+    constexpr std::size_t GRID_NESTED_SAMPLE{500};
+
+    // Scaling: batch sizes swept on one thread, options priced per timing sample at every size,
+    // book size and paths for the thread sweeps, default regression threshold against a baseline
+    const std::vector<std::size_t> SCALING_BATCH_SIZES = {1, 10, 100, 1000, 10000, 100000, 1000000};
+    constexpr std::size_t SCALING_OPTIONS_PER_SAMPLE{1000000};
+    constexpr std::size_t SCALING_THREAD_BOOK_SIZE{1000000};
+    constexpr std::size_t SCALING_CHUNK_SIZE{16384};
+    constexpr int SCALING_PATHS{1000000};
+    constexpr double REGRESSION_THRESHOLD_PERCENT{10.0};
+
+    // Columnar vs text books: options per file, priced with Black-Scholes on every core
+    constexpr std::size_t COLUMNAR_OPTIONS{10000000};
+
+    // Pricing server: batching delays and client counts swept, single-option Black-Scholes requests
+    // split evenly over the connections
+    const std::vector<double> SERVER_DELAYS_US = {0.0, 100.0};
+    const std::vector<unsigned int> SERVER_CONNECTIONS = {1, 4, 16};
+    constexpr std::size_t SERVER_REQUESTS{20000};
+
+    // Single precision: Black-Scholes error grid around SPOT_PRICE (strikes 50-150% in steps, every
+    // volatility x expiry x rate, calls and puts), Monte Carlo options checked against Black-Scholes,
+    // relative errors only counted where the Double value exceeds the floor
+    constexpr double PRECISION_STRIKE_STEP{5.0};
+    const std::vector<double> PRECISION_VOLATILITIES = {0.05, 0.1, 0.15, 0.2, 0.3, 0.4, 0.5, 0.6, 0.8, 1.0};
+    const std::vector<double> PRECISION_EXPIRIES = {1.0 / 365.0, 1.0 / 52.0, 1.0 / 12.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0};
+    const std::vector<double> PRECISION_RATES = {0.0, 0.03, 0.08};
+    constexpr double PRECISION_RELATIVE_FLOOR{0.01};
+    const std::vector<double> PRECISION_MC_STRIKES = {70.0, 100.0, 130.0};
+    const std::vector<double> PRECISION_MC_VOLATILITIES = {0.1, 0.3, 0.6};
+    const std::vector<double> PRECISION_MC_EXPIRIES = {0.1, 1.0, 3.0};
+    constexpr int PRECISION_MC_PATHS{400000};
+    constexpr int PRECISION_MC_TIMING_PATHS{1000000};
+
+    // Instrumentation report: Black-Scholes calls and Monte Carlo pricings profiled per probe
+    constexpr int PROFILE_BS_CALLS{100000};
+    constexpr int PROFILE_MC_CALLS{20};
+    constexpr int PROFILE_MC_PATHS{100000};
 
     // Monte Carlo path configurations
     const std::vector CONVERGENCE_PATHS = {1000, 5000, 10000, 50000, 100000, 500000};
     const std::vector PERFORMANCE_PATHS = {1000, 10000, 100000};
     const std::vector GREEKS_PATHS = {10000, 50000, 100000};
     const std::vector ACCURACY_PATHS = {10000, 50000, 100000, 500000};
+    constexpr int THREADING_PATHS{1000000};
+
+    // Mixed portfolio: many analytical jobs next to a few long simulations
+    constexpr int PORTFOLIO_BS_JOBS{10000};
+    constexpr int PORTFOLIO_MC_JOBS{16};
+    constexpr int PORTFOLIO_QMC_JOBS{4};
+    constexpr int PORTFOLIO_MC_PATHS{200000};
+
+    // Pricing cache: hit timing repetitions, capacity, quote working sets and passes over each
+    constexpr int CACHE_HIT_ITERATIONS{100000};
+    constexpr std::size_t CACHE_CAPACITY{4096};
+    const std::vector<std::size_t> CACHE_WORKING_SETS = {1024, 2048, 16384};
+    constexpr int CACHE_PASSES{4};
+
+    // Early stopping targets (discounted standard error), capped at MAX_TARGET_PATHS
+    const std::vector TARGET_ERRORS = {0.05, 0.02, 0.01, 0.005};
+    constexpr int MAX_TARGET_PATHS{10000000};
+
+    // Variance reduction comparison, same path budget for every mode
+    constexpr int VARIANCE_REDUCTION_PATHS{100000};
+
+    // Quasi-Monte Carlo: total points per pricing, split over QMC_REPLICATES scrambled replicates
+    const std::vector QMC_TOTAL_PATHS = {16384, 65536, 262144, 1048576};
+    constexpr int QMC_REPLICATES{16};
 
     // Finite difference epsilon
     constexpr double FD_EPSILON{0.01};
@@ -98,6 +233,52 @@ MarketParameters createTestMarket() {
     };
 }
 
+// Every section records into one harness, so --json can export the whole run
+Benchmark &sharedHarness() {
+    static Benchmark harness;
+    return harness;
+}
+
+// 1, 2, 4, ... up to every hardware thread
+std::vector<unsigned int> defaultThreadCounts() {
+    std::vector<unsigned int> thread_counts;
+    for (unsigned int threads = 1; threads < ThreadPool::hardwareThreads(); threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(ThreadPool::hardwareThreads());
+    return thread_counts;
+}
+
+// Struct-of-arrays book with strikes from 50% to 150% of spot, expiries up to 2 years, calls and puts alternating
+struct OptionBook {
+    std::vector<double> strike;
+    std::vector<double> expiry;
+    std::vector<Option::Type> type;
+    std::vector<double> spot;
+    std::vector<double> rate;
+    std::vector<double> volatility;
+
+    explicit OptionBook(const std::size_t size)
+        : strike(size), expiry(size), type(size),
+          spot(size, BenchmarkConfig::SPOT_PRICE),
+          rate(size, BenchmarkConfig::RISK_FREE_RATE),
+          volatility(size, BenchmarkConfig::VOLATILITY) {
+        for (std::size_t i = 0; i < size; ++i) {
+            strike[i] = BenchmarkConfig::SPOT_PRICE * (0.5 + static_cast<double>(i % 101) / 100.0);
+            expiry[i] = 0.1 + static_cast<double>(i % 20) / 10.0;
+            type[i] = (i % 2 == 0) ? Option::Type::CALL : Option::Type::PUT;
+        }
+    }
+
+    [[nodiscard]] OptionBatch view() const {
+        return OptionBatch{
+            strike.data(), expiry.data(), type.data(),
+            spot.data(), rate.data(), volatility.data(),
+            strike.size()
+        };
+    }
+};
+
 
 void runConvergenceBenchmark() {
     printSectionHeader("CONVERGENCE BENCHMARK");
@@ -124,14 +305,14 @@ void runConvergenceBenchmark() {
 
     printTableSeparator();
 
-    Benchmark benchmark;
+    Benchmark &benchmark = sharedHarness();
 
     for (const int paths: BenchmarkConfig::CONVERGENCE_PATHS) {
         SimulationParameters params{paths, BenchmarkConfig::RANDOM_SEED};
         MonteCarloEngine mc_engine{params};
 
         const auto bench_result = benchmark.run(
-            "MC_" + std::to_string(paths),
+            "MC_Convergence_" + std::to_string(paths),
             [&]() { return mc_engine.price(call, market).price; },
             1
         );
@@ -150,6 +331,478 @@ void runConvergenceBenchmark() {
                 << std::setw(15) << formatMicroseconds(bench_result.time_microseconds)
                 << "\n";
     }
+
+    printSubsectionHeader("Quasi-Monte Carlo (scrambled Sobol) vs Monte Carlo");
+
+    std::cout << std::left
+            << std::setw(12) << "Paths"
+            << std::setw(12) << "MC Error"
+            << std::setw(12) << "MC SE"
+            << std::setw(12) << "MC Time"
+            << std::setw(12) << "QMC Error"
+            << std::setw(12) << "QMC SE"
+            << std::setw(12) << "QMC Time"
+            << "\n";
+    printTableSeparator();
+
+    for (const int paths: BenchmarkConfig::QMC_TOTAL_PATHS) {
+        const MonteCarloEngine mc_engine{SimulationParameters{paths, BenchmarkConfig::RANDOM_SEED}};
+        const QuasiMonteCarloEngine qmc_engine{
+            QuasiMonteCarloParameters{
+                paths / BenchmarkConfig::QMC_REPLICATES,
+                BenchmarkConfig::QMC_REPLICATES,
+                BenchmarkConfig::RANDOM_SEED
+            }
+        };
+
+        const auto mc_time = benchmark.run(
+            "MC_" + std::to_string(paths),
+            [&]() { return mc_engine.price(call, market).price; },
+            1
+        );
+        const auto qmc_time = benchmark.run(
+            "QMC_" + std::to_string(paths),
+            [&]() { return qmc_engine.price(call, market).price; },
+            1
+        );
+
+        const auto mc_result = mc_engine.price(call, market);
+        const auto qmc_result = qmc_engine.price(call, market);
+
+        std::cout << std::left
+                << std::setw(12) << paths
+                << std::setw(12) << formatNumber(std::abs(mc_result.price - true_price), 4)
+                << std::setw(12) << formatNumber(mc_result.standard_error.value(), 4)
+                << std::setw(12) << formatMicroseconds(mc_time.time_microseconds)
+                << std::setw(12) << formatNumber(std::abs(qmc_result.price - true_price), 4)
+                << std::setw(12) << formatNumber(qmc_result.standard_error.value(), 4)
+                << std::setw(12) << formatMicroseconds(qmc_time.time_microseconds)
+                << "\n";
+    }
+
+    printSubsectionHeader("Target Precision (early stopping)");
+
+    std::cout << std::left
+            << std::setw(14) << "Target SE"
+            << std::setw(14) << "Paths Used"
+            << std::setw(12) << "Price"
+            << std::setw(12) << "Std Error"
+            << std::setw(15) << "Time"
+            << "\n";
+    printTableSeparator();
+
+    for (const double target: BenchmarkConfig::TARGET_ERRORS) {
+        SimulationParameters params{BenchmarkConfig::MAX_TARGET_PATHS, BenchmarkConfig::RANDOM_SEED};
+        params.target_standard_error = target;
+        const MonteCarloEngine mc_engine{params};
+
+        const auto bench_result = benchmark.run(
+            "MC_Target_" + formatNumber(target, 3),
+            [&]() { return mc_engine.price(call, market).price; },
+            1
+        );
+        const auto pricing_result = mc_engine.price(call, market);
+
+        std::cout << std::left
+                << std::setw(14) << formatNumber(target, 3)
+                << std::setw(14) << pricing_result.paths_used.value()
+                << std::setw(12) << formatNumber(pricing_result.price, BenchmarkConfig::PRICE_PRECISION)
+                << std::setw(12) << formatNumber(pricing_result.standard_error.value(), 4)
+                << std::setw(15) << formatMicroseconds(bench_result.time_microseconds)
+                << "\n";
+    }
+
+    printSubsectionHeader("Variance Reduction (" + std::to_string(BenchmarkConfig::VARIANCE_REDUCTION_PATHS) + " paths)");
+
+    std::cout << std::left
+            << std::setw(22) << "Mode"
+            << std::setw(12) << "Price"
+            << std::setw(12) << "Error"
+            << std::setw(12) << "Std Error"
+            << std::setw(12) << "VR Factor"
+            << std::setw(15) << "Time"
+            << "\n";
+    printTableSeparator();
+
+    struct VarianceReductionMode {
+        std::string label;
+        bool antithetic;
+        ControlVariate control_variate;
+        bool moment_matching;
+    };
+
+    const std::vector<VarianceReductionMode> modes = {
+        {"Plain", false, ControlVariate::None, false},
+        {"Antithetic", true, ControlVariate::None, false},
+        {"Moment matching", false, ControlVariate::None, true},
+        {"Control (spot)", false, ControlVariate::TerminalSpot, false},
+        {"Control (BS)", false, ControlVariate::BlackScholes, false},
+        {"Antithetic + spot", true, ControlVariate::TerminalSpot, false},
+    };
+
+    for (const auto &mode: modes) {
+        SimulationParameters params{BenchmarkConfig::VARIANCE_REDUCTION_PATHS, BenchmarkConfig::RANDOM_SEED};
+        params.antithetic = mode.antithetic;
+        params.control_variate = mode.control_variate;
+        params.moment_matching = mode.moment_matching;
+        const MonteCarloEngine mc_engine{params};
+
+        const auto bench_result = benchmark.run(
+            "MC_VR_" + mode.label,
+            [&]() { return mc_engine.price(call, market).price; },
+            BenchmarkConfig::MC_ITERATIONS
+        );
+        const auto pricing_result = mc_engine.price(call, market);
+
+        std::cout << std::left
+                << std::setw(22) << mode.label
+                << std::setw(12) << formatNumber(pricing_result.price, BenchmarkConfig::PRICE_PRECISION)
+                << std::setw(12) << formatNumber(std::abs(pricing_result.price - true_price), 4)
+                << std::setw(12) << formatNumber(pricing_result.standard_error.value(), 4)
+                << std::setw(12) << formatNumber(pricing_result.variance_reduction_factor.value(), 2) + "x"
+                << std::setw(15) << formatMicroseconds(bench_result.time_per_iteration_microseconds())
+                << "\n";
+    }
+}
+
+void runPreparedOptionBenchmark() {
+    printSubsectionHeader("Spot-Tick Repricing (PreparedOption, " + std::to_string(BenchmarkConfig::SPOT_TICKS) + " ticks)");
+
+    const auto call = createTestOption();
+    const PreparedOption prepared{call, BenchmarkConfig::RISK_FREE_RATE, BenchmarkConfig::VOLATILITY};
+
+    // Spot walks over a small range so no tick repeats the previous input
+    const auto tick_spot = [](const int tick) { return BenchmarkConfig::SPOT_PRICE + 0.01 * static_cast<double>(tick & 63); };
+
+    std::cout << std::left
+            << std::setw(12) << "CDF Tier"
+            << std::setw(16) << "price()"
+            << std::setw(16) << "Prepared"
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+
+    const std::vector<std::pair<std::string, CdfAccuracy>> tiers = {
+        {"Full", CdfAccuracy::Full}, {"High", CdfAccuracy::High}, {"Fast", CdfAccuracy::Fast}
+    };
+
+    Benchmark &benchmark = sharedHarness();
+    for (const auto &[label, accuracy]: tiers) {
+        const BlackScholesEngine engine{accuracy};
+
+        const auto plain = benchmark.run(
+            "Tick_Plain_" + label,
+            [&]() {
+                double total = 0.0;
+                for (int tick = 0; tick < BenchmarkConfig::SPOT_TICKS; ++tick) {
+                    const MarketParameters market{tick_spot(tick), BenchmarkConfig::RISK_FREE_RATE, BenchmarkConfig::VOLATILITY};
+                    total += engine.price(call, market).price;
+                }
+                return total;
+            },
+            1
+        );
+        const auto fast = benchmark.run(
+            "Tick_Prepared_" + label,
+            [&]() {
+                double total = 0.0;
+                for (int tick = 0; tick < BenchmarkConfig::SPOT_TICKS; ++tick) {
+                    total += engine.price(prepared, tick_spot(tick)).price;
+                }
+                return total;
+            },
+            1
+        );
+
+        const double plain_time = plain.time_per_iteration_microseconds() / BenchmarkConfig::SPOT_TICKS;
+        const double prepared_time = fast.time_per_iteration_microseconds() / BenchmarkConfig::SPOT_TICKS;
+        std::cout << std::left
+                << std::setw(12) << label
+                << std::setw(16) << formatMicroseconds(plain_time)
+                << std::setw(16) << formatMicroseconds(prepared_time)
+                << formatNumber(plain_time / prepared_time, 2) + "x"
+                << "\n";
+    }
+}
+
+void runCompactResultBenchmark() {
+    printSubsectionHeader("Result Types (" + std::to_string(BenchmarkConfig::BATCH_SIZE) + " quotes, caller-owned buffer)");
+
+    const OptionBook book{BenchmarkConfig::BATCH_SIZE};
+    const OptionBatch batch = book.view();
+    const BlackScholesEngine engine;
+    const PricingEngine &generic = engine;
+
+    std::vector<Option> options;
+    std::vector<MarketParameters> markets;
+    for (std::size_t i = 0; i < batch.size; ++i) {
+        options.emplace_back(batch.strike[i], batch.type[i], batch.expiry[i]);
+        markets.emplace_back(batch.spot[i], batch.rate[i], batch.volatility[i]);
+    }
+    std::vector<PricingResult> full_results(batch.size, PricingResult{0.0});
+    std::vector<CompactPricingResult> compact_results(batch.size);
+
+    Benchmark &benchmark = sharedHarness();
+    const auto full = benchmark.run(
+        "Result_PricingResult",
+        [&]() {
+            for (std::size_t i = 0; i < batch.size; ++i) {
+                full_results[i] = generic.price(options[i], markets[i]);
+            }
+            return full_results[0].price;
+        },
+        BenchmarkConfig::BATCH_ITERATIONS
+    );
+    const auto compact = benchmark.run(
+        "Result_Compact",
+        [&]() {
+            for (std::size_t i = 0; i < batch.size; ++i) {
+                generic.priceInto(options[i], markets[i], compact_results[i]);
+            }
+            return compact_results[0].price;
+        },
+        BenchmarkConfig::BATCH_ITERATIONS
+    );
+
+    const double count = static_cast<double>(batch.size);
+    const double full_time = full.time_per_iteration_microseconds() / count;
+    const double compact_time = compact.time_per_iteration_microseconds() / count;
+
+    std::cout << std::left
+            << std::setw(38) << "Method"
+            << std::setw(16) << "Time/Quote"
+            << std::setw(16) << "Result Size"
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+    std::cout << std::left
+            << std::setw(38) << "price() -> PricingResult"
+            << std::setw(16) << formatMicroseconds(full_time)
+            << std::setw(16) << std::to_string(sizeof(PricingResult)) + " B"
+            << "1.00x"
+            << "\n";
+    std::cout << std::left
+            << std::setw(38) << "priceInto() -> CompactPricingResult"
+            << std::setw(16) << formatMicroseconds(compact_time)
+            << std::setw(16) << std::to_string(sizeof(CompactPricingResult)) + " B"
+            << formatNumber(full_time / compact_time, 2) + "x"
+            << "\n";
+}
+
+void runThreadingBenchmark() {
+    printSubsectionHeader("Monte Carlo Threading (" + std::to_string(BenchmarkConfig::THREADING_PATHS) + " paths)");
+
+    const auto call = createTestOption();
+    const auto market = createTestMarket();
+
+    const std::vector<unsigned int> thread_counts = defaultThreadCounts();
+
+    std::cout << std::left
+            << std::setw(12) << "Threads"
+            << std::setw(16) << "Time/Pricing"
+            << std::setw(12) << "Speedup"
+            << std::setw(24) << "Price"
+            << std::setw(16) << "Std Error"
+            << "\n";
+    printTableSeparator();
+
+    Benchmark &benchmark = sharedHarness();
+    double baseline_time = 0;
+
+    for (const unsigned int threads: thread_counts) {
+        const SimulationParameters params{BenchmarkConfig::THREADING_PATHS, BenchmarkConfig::RANDOM_SEED, threads};
+        const MonteCarloEngine engine{params};
+
+        const auto result = benchmark.run(
+            "MC_Threads_" + std::to_string(threads),
+            [&]() { return engine.price(call, market).price; },
+            BenchmarkConfig::MC_ITERATIONS
+        );
+        const auto pricing = engine.price(call, market);
+
+        const double time_per_iter = result.time_per_iteration_microseconds();
+        if (threads == 1) baseline_time = time_per_iter;
+
+        // Full precision makes it visible that every thread count gives the same bits
+        std::ostringstream price_text;
+        price_text << std::setprecision(17) << pricing.price;
+
+        std::cout << std::left
+                << std::setw(12) << threads
+                << std::setw(16) << formatMicroseconds(time_per_iter)
+                << std::setw(12) << formatNumber(baseline_time / time_per_iter, 2) + "x"
+                << std::setw(24) << price_text.str()
+                << std::setw(16) << formatNumber(pricing.standard_error.value(), 6)
+                << "\n";
+    }
+}
+
+void runPortfolioBenchmark() {
+    printSubsectionHeader("Portfolio Pricing ("
+                          + std::to_string(BenchmarkConfig::PORTFOLIO_BS_JOBS) + " BS, "
+                          + std::to_string(BenchmarkConfig::PORTFOLIO_MC_JOBS) + " MC, "
+                          + std::to_string(BenchmarkConfig::PORTFOLIO_QMC_JOBS) + " QMC jobs)");
+
+    const auto market = createTestMarket();
+    const SimulationParameters simulation{BenchmarkConfig::PORTFOLIO_MC_PATHS, BenchmarkConfig::RANDOM_SEED};
+
+    // Simulations first, so analytical jobs would sit behind them in a plain FIFO
+    std::vector<PricingJob> jobs;
+    for (int i = 0; i < BenchmarkConfig::PORTFOLIO_MC_JOBS; ++i) {
+        jobs.push_back(PricingJob{Option{90.0 + i, Option::Type::CALL, 1.0}, market, EngineType::MonteCarlo});
+    }
+    for (int i = 0; i < BenchmarkConfig::PORTFOLIO_QMC_JOBS; ++i) {
+        jobs.push_back(PricingJob{Option{95.0 + i, Option::Type::PUT, 1.0}, market, EngineType::QuasiMonteCarlo});
+    }
+    for (int i = 0; i < BenchmarkConfig::PORTFOLIO_BS_JOBS; ++i) {
+        const auto type = i % 2 == 0 ? Option::Type::CALL : Option::Type::PUT;
+        jobs.push_back(PricingJob{Option{80.0 + 0.004 * i, type, 0.25 + 0.0001 * i}, market, EngineType::BlackScholes});
+    }
+
+    // Sequential reference: one engine of each kind, jobs in input order
+    const BlackScholesEngine bs_engine;
+    const MonteCarloEngine mc_engine{simulation};
+    const QuasiMonteCarloEngine qmc_engine;
+
+    Timer timer;
+    timer.start();
+    double checksum = 0.0;
+    for (const auto &job: jobs) {
+        switch (job.engine) {
+            case EngineType::BlackScholes: checksum += bs_engine.price(job.option, job.market).price; break;
+            case EngineType::MonteCarlo: checksum += mc_engine.price(job.option, job.market).price; break;
+            case EngineType::QuasiMonteCarlo: checksum += qmc_engine.price(job.option, job.market).price; break;
+        }
+    }
+    const double sequential_time = timer.stop();
+
+    std::cout << std::left
+            << std::setw(10) << "Threads"
+            << std::setw(12) << "Wall"
+            << std::setw(10) << "Speedup"
+            << std::setw(12) << "p50 Lat"
+            << std::setw(12) << "p99 Lat"
+            << std::setw(12) << "BS Max"
+            << std::setw(12) << "Price Diff"
+            << "\n";
+    printTableSeparator();
+
+    std::cout << std::left
+            << std::setw(10) << "seq"
+            << std::setw(12) << formatMicroseconds(sequential_time)
+            << std::setw(10) << "1.00x"
+            << std::setw(12) << "-"
+            << std::setw(12) << "-"
+            << std::setw(12) << "-"
+            << std::setw(12) << "-"
+            << "\n";
+
+    const PortfolioPricer pricer{0, simulation};
+    const PortfolioReport report = pricer.price(jobs);
+
+    double bs_max_latency = 0.0;
+    double portfolio_checksum = 0.0;
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        portfolio_checksum += report.jobs[i].result.price;
+        if (jobs[i].engine == EngineType::BlackScholes) {
+            bs_max_latency = std::max(bs_max_latency, report.jobs[i].latency_microseconds);
+        }
+    }
+
+    std::cout << std::left
+            << std::setw(10) << pricer.size()
+            << std::setw(12) << formatMicroseconds(report.wall_time_microseconds)
+            << std::setw(10) << formatNumber(sequential_time / report.wall_time_microseconds, 2) + "x"
+            << std::setw(12) << formatMicroseconds(report.median_latency_microseconds)
+            << std::setw(12) << formatMicroseconds(report.p99_latency_microseconds)
+            << std::setw(12) << formatMicroseconds(bs_max_latency)
+            << std::setw(12) << formatNumber(std::abs(portfolio_checksum - checksum), 8)
+            << "\n";
+}
+
+void runCacheBenchmark() {
+    printSubsectionHeader("Pricing Cache (capacity " + std::to_string(BenchmarkConfig::CACHE_CAPACITY) + ")");
+
+    const auto call = createTestOption();
+    const auto market = createTestMarket();
+
+    const BlackScholesEngine bs_engine;
+    const MonteCarloEngine mc_engine{SimulationParameters{BenchmarkConfig::THREADING_PATHS / 10, BenchmarkConfig::RANDOM_SEED}};
+    const std::vector<std::pair<std::string, const PricingEngine *>> engines = {
+        {"Black-Scholes", &bs_engine},
+        {"Monte Carlo (100K)", &mc_engine}
+    };
+
+    std::cout << std::left
+            << std::setw(24) << "Engine"
+            << std::setw(16) << "Uncached"
+            << std::setw(16) << "Cache Hit"
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+
+    Benchmark &benchmark = sharedHarness();
+    for (const auto &[label, engine]: engines) {
+        const CachedPricingEngine cached{*engine, CacheParameters{BenchmarkConfig::CACHE_CAPACITY}};
+        const double uncached_time = benchmark.run(
+            "Uncached_" + label,
+            [&]() { return engine->price(call, market).price; },
+            BenchmarkConfig::MC_ITERATIONS
+        ).time_per_iteration_microseconds();
+
+        (void) cached.price(call, market);
+        const double hit_time = benchmark.run(
+            "Cached_" + label,
+            [&]() { return cached.price(call, market).price; },
+            BenchmarkConfig::CACHE_HIT_ITERATIONS
+        ).time_per_iteration_microseconds();
+
+        std::cout << std::left
+                << std::setw(24) << label
+                << std::setw(16) << formatMicroseconds(uncached_time)
+                << std::setw(16) << formatMicroseconds(hit_time)
+                << formatNumber(uncached_time / hit_time, 0) + "x"
+                << "\n";
+    }
+
+    // Repeated passes over a working set of distinct quotes, smaller and larger than the cache
+    std::cout << "\n" << std::left
+            << std::setw(16) << "Working Set"
+            << std::setw(12) << "Hit Rate"
+            << std::setw(14) << "Evictions"
+            << "Time/Quote"
+            << "\n";
+    printTableSeparator();
+
+    for (const std::size_t working_set: BenchmarkConfig::CACHE_WORKING_SETS) {
+        const CachedPricingEngine cached{bs_engine, CacheParameters{BenchmarkConfig::CACHE_CAPACITY}};
+        const auto result = benchmark.run(
+            "Cache_Quotes_" + std::to_string(working_set),
+            [&]() {
+                double total = 0.0;
+                for (int pass = 0; pass < BenchmarkConfig::CACHE_PASSES; ++pass) {
+                    for (std::size_t i = 0; i < working_set; ++i) {
+                        const Option option{50.0 + 0.01 * static_cast<double>(i), Option::Type::CALL, BenchmarkConfig::TIME_TO_EXPIRY};
+                        total += cached.price(option, market).price;
+                    }
+                }
+                return total;
+            },
+            1
+        );
+        const CacheStatistics stats = cached.statistics();
+        const double quotes = static_cast<double>(working_set) * BenchmarkConfig::CACHE_PASSES;
+
+        std::ostringstream hit_rate;
+        hit_rate << std::fixed << std::setprecision(1) << 100.0 * stats.hitRate() << "%";
+
+        std::cout << std::left
+                << std::setw(16) << working_set
+                << std::setw(12) << hit_rate.str()
+                << std::setw(14) << stats.evictions
+                << formatMicroseconds(result.time_per_iteration_microseconds() / quotes)
+                << "\n";
+    }
 }
 
 void runPerformanceBenchmark() {
@@ -158,7 +811,7 @@ void runPerformanceBenchmark() {
     const auto call = createTestOption();
     const auto market = createTestMarket();
 
-    Benchmark benchmark;
+    Benchmark &benchmark = sharedHarness();
 
     // Black-Scholes Performance
     printSubsectionHeader("Analytical Pricing (Black-Scholes)"); {
@@ -173,6 +826,61 @@ void runPerformanceBenchmark() {
         std::cout << "  Total time:          " << formatMicroseconds(result.time_microseconds) << "\n";
         std::cout << "  Time per pricing:    " << formatMicroseconds(result.time_per_iteration_microseconds()) << "\n";
         std::cout << "  Pricings per second: " << formatNumber(result.iterations_per_second(), 0) << "\n";
+
+        const BenchmarkStatistics &stats = result.statistics;
+        std::cout << "  Samples:             " << stats.samples << " (" << stats.outliers << " outliers rejected)\n";
+        std::cout << "  Mean, 95% CI:        " << formatNumber(stats.mean, 2) << " ns ["
+                << formatNumber(stats.ci_low, 2) << ", " << formatNumber(stats.ci_high, 2) << "]\n";
+        std::cout << "  Median / p90 / p99:  " << formatNumber(stats.median, 2) << " / "
+                << formatNumber(stats.p90, 2) << " / " << formatNumber(stats.p99, 2) << " ns ("
+                << stats.latency_samples << " timings of " << stats.calls_per_latency_sample << " calls)\n";
+    }
+
+    // Batch Black-Scholes Performance
+    printSubsectionHeader("Batch Pricing (Black-Scholes, struct-of-arrays)"); {
+        const BlackScholesEngine engine;
+        const OptionBook book{BenchmarkConfig::BATCH_SIZE};
+        const OptionBatch batch = book.view();
+
+        std::vector<double> prices(batch.size), deltas(batch.size), gammas(batch.size);
+        std::vector<double> vegas(batch.size), thetas(batch.size), rhos(batch.size);
+        const BatchResults results{
+            prices.data(), deltas.data(), gammas.data(), vegas.data(), thetas.data(), rhos.data()
+        };
+
+        const auto loop_result = benchmark.run(
+            "BS_Loop",
+            [&]() {
+                for (std::size_t i = 0; i < batch.size; ++i) {
+                    const Option option{batch.strike[i], batch.type[i], batch.expiry[i]};
+                    const MarketParameters market_i{batch.spot[i], batch.rate[i], batch.volatility[i]};
+                    prices[i] = engine.price(option, market_i).price;
+                }
+                return prices[0];
+            },
+            BenchmarkConfig::BATCH_ITERATIONS
+        );
+
+        const auto batch_result = benchmark.run(
+            "BS_Batch",
+            [&]() {
+                engine.priceBatch(batch, results);
+                return prices[0];
+            },
+            BenchmarkConfig::BATCH_ITERATIONS
+        );
+
+        const double options_per_iteration = static_cast<double>(batch.size);
+        const double loop_per_option = loop_result.time_per_iteration_microseconds() / options_per_iteration;
+        const double batch_per_option = batch_result.time_per_iteration_microseconds() / options_per_iteration;
+
+        std::cout << "  Book size:           " << batch.size << " options\n";
+        std::cout << "  Vector width:        " << Simd::DoubleVec::width << " doubles\n";
+        std::cout << "  Per-option loop:     " << formatMicroseconds(loop_result.time_per_iteration_microseconds())
+                << " (" << formatMicroseconds(loop_per_option) << " per option)\n";
+        std::cout << "  Batch (with Greeks): " << formatMicroseconds(batch_result.time_per_iteration_microseconds())
+                << " (" << formatMicroseconds(batch_per_option) << " per option)\n";
+        std::cout << "  Speedup:             " << formatNumber(loop_per_option / batch_per_option, 2) << "x\n";
     }
 
     // Monte Carlo Performance
@@ -213,6 +921,12 @@ void runPerformanceBenchmark() {
                 << std::setw(20) << formatNumber(relative_speed, 2) + "x"
                 << "\n";
     }
+
+    runPreparedOptionBenchmark();
+    runCompactResultBenchmark();
+    runThreadingBenchmark();
+    runPortfolioBenchmark();
+    runCacheBenchmark();
 }
 
 void printGreeksRow(const std::string &label, const Greeks &greeks) {
@@ -262,7 +976,7 @@ void runGreeksBenchmark() {
             << "\n";
     printTableSeparator();
 
-    Benchmark benchmark;
+    Benchmark &benchmark = sharedHarness();
 
     // Black-Scholes (Greeks are essentially free)
     {
@@ -281,12 +995,16 @@ void runGreeksBenchmark() {
                 << "\n";
     }
 
-    // Monte Carlo with finite differences
+    // Monte Carlo: finite differences reprice, pathwise Greeks come from the pricing paths
     for (const int paths: BenchmarkConfig::GREEKS_PATHS) {
         SimulationParameters params{paths, BenchmarkConfig::RANDOM_SEED};
+        params.compute_greeks = false;
         MonteCarloEngine mc_engine{params};
         FiniteDifferenceGreeks greeks_calc{mc_engine, BenchmarkConfig::FD_EPSILON};
 
+        params.compute_greeks = true;
+        MonteCarloEngine pathwise_engine{params};
+
         // Price only
         const auto price_only = benchmark.run(
             "MC_Price_" + std::to_string(paths),
@@ -304,18 +1022,29 @@ void runGreeksBenchmark() {
             1
         );
 
+        const auto with_pathwise = benchmark.run(
+            "MC_Pathwise_" + std::to_string(paths),
+            [&]() { return pathwise_engine.price(call, market).greeks.delta.value_or(0.0); },
+            BenchmarkConfig::GREEKS_ITERATIONS
+        );
+
         const double price_time = price_only.time_per_iteration_microseconds();
-        const double greeks_time = with_greeks.time_microseconds;
-        const double overhead_percent = ((greeks_time - price_time) / price_time) * 100;
-        const double factor = greeks_time / price_time;
 
-        std::cout << std::left
-                << std::setw(25) << ("Monte Carlo (" + std::to_string(paths) + ")")
-                << std::setw(15) << formatMicroseconds(price_time)
-                << std::setw(15) << formatMicroseconds(greeks_time)
-                << std::setw(15) << formatNumber(overhead_percent, 1) + "%"
-                << std::setw(15) << formatNumber(factor, 1) + "x"
-                << "\n";
+        auto printRow = [&](const std::string &label, const double greeks_time) {
+            const double overhead_percent = ((greeks_time - price_time) / price_time) * 100;
+            const double factor = greeks_time / price_time;
+
+            std::cout << std::left
+                    << std::setw(25) << label
+                    << std::setw(15) << formatMicroseconds(price_time)
+                    << std::setw(15) << formatMicroseconds(greeks_time)
+                    << std::setw(15) << formatNumber(overhead_percent, 1) + "%"
+                    << std::setw(15) << formatNumber(factor, 1) + "x"
+                    << "\n";
+        };
+
+        printRow("MC FD (" + std::to_string(paths) + ")", with_greeks.time_microseconds);
+        printRow("MC Pathwise (" + std::to_string(paths) + ")", with_pathwise.time_per_iteration_microseconds());
     }
 
     // Accuracy comparison
@@ -331,47 +1060,1601 @@ void runGreeksBenchmark() {
             << "\n";
     printTableSeparator();
 
+    auto calcError = [](const std::optional<double> &mc, const std::optional<double> &bs) {
+        if (mc.has_value() && bs.has_value()) {
+            return std::abs(mc.value() - bs.value());
+        }
+        return 0.0;
+    };
+
+    auto printErrorRow = [&](const int paths, const Greeks &greeks) {
+        std::cout << std::left
+                << std::setw(12) << paths
+                << std::setw(12) << formatNumber(calcError(greeks.delta, bs_result.greeks.delta), 4)
+                << std::setw(12) << formatNumber(calcError(greeks.gamma, bs_result.greeks.gamma), 4)
+                << std::setw(12) << formatNumber(calcError(greeks.vega, bs_result.greeks.vega), 4)
+                << std::setw(12) << formatNumber(calcError(greeks.theta, bs_result.greeks.theta), 4)
+                << std::setw(12) << formatNumber(calcError(greeks.rho, bs_result.greeks.rho), 4)
+                << "\n";
+    };
+
     for (const int paths: BenchmarkConfig::ACCURACY_PATHS) {
         SimulationParameters params{paths, BenchmarkConfig::RANDOM_SEED};
+        params.compute_greeks = false;
         MonteCarloEngine mc_engine{params};
         FiniteDifferenceGreeks greeks_calc{mc_engine, BenchmarkConfig::FD_EPSILON};
 
-        const auto [mc_delta, mc_gamma, mc_vega, mc_theta, mc_rho] = greeks_calc.calculate(call, market);
-
-        auto calcError = [](const std::optional<double> &mc, const std::optional<double> &bs) {
-            if (mc.has_value() && bs.has_value()) {
-                return std::abs(mc.value() - bs.value());
-            }
-            return 0.0;
-        };
-
-        std::cout << std::left
-                << std::setw(12) << paths
-                << std::setw(12) << formatNumber(calcError(mc_delta, bs_result.greeks.delta), 4)
-                << std::setw(12) << formatNumber(calcError(mc_gamma, bs_result.greeks.gamma), 4)
-                << std::setw(12) << formatNumber(calcError(mc_vega, bs_result.greeks.vega), 4)
-                << std::setw(12) << formatNumber(calcError(mc_theta, bs_result.greeks.theta), 4)
-                << std::setw(12) << formatNumber(calcError(mc_rho, bs_result.greeks.rho), 4)
-                << "\n";
+        printErrorRow(paths, greeks_calc.calculate(call, market));
     }
-}
 
-void printSummary() {
-    printSectionHeader("BENCHMARK SUMMARY");
+    printSubsectionHeader("Greeks Accuracy (Pathwise / Likelihood Ratio vs Analytical)");
 
-    std::cout << "Test Configuration:\n";
-    std::cout << "  Option Type:    European Call\n";
-    std::cout << std::setprecision(2);
-    std::cout << "  Spot Price:     $" << BenchmarkConfig::SPOT_PRICE << "\n";
-    std::cout << "  Strike Price:   $" << BenchmarkConfig::STRIKE_PRICE << "\n";
+    std::cout << std::left
+            << std::setw(12) << "Paths"
+            << std::setw(12) << "Delta Err"
+            << std::setw(12) << "Gamma Err"
+            << std::setw(12) << "Vega Err"
+            << std::setw(12) << "Theta Err"
+            << std::setw(12) << "Rho Err"
+            << "\n";
+    printTableSeparator();
+
+    for (const int paths: BenchmarkConfig::ACCURACY_PATHS) {
+        const MonteCarloEngine mc_engine{SimulationParameters{paths, BenchmarkConfig::RANDOM_SEED}};
+        printErrorRow(paths, mc_engine.price(call, market).greeks);
+    }
+}
+
+// Evaluates the CDF tier on every point with the scalar form
+template<CdfAccuracy Accuracy>
+void evaluateCdfScalar(const std::vector<double> &x, std::vector<double> &out) {
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        out[i] = FinancialMath::normalCDF<Accuracy>(x[i]);
+    }
+}
+
+// Evaluates the CDF tier with the SIMD form, the tail that does not fill a vector falls back to scalar
+template<CdfAccuracy Accuracy>
+void evaluateCdfVectorized(const std::vector<double> &x, std::vector<double> &out) {
+    constexpr std::size_t width = Simd::DoubleVec::width;
+    std::size_t i = 0;
+    for (; i + width <= x.size(); i += width) {
+        FinancialMath::normalCDF<Accuracy>(Simd::DoubleVec::load(&x[i])).store(&out[i]);
+    }
+    for (; i < x.size(); ++i) {
+        out[i] = FinancialMath::normalCDF<Accuracy>(x[i]);
+    }
+}
+
+double maxAbsoluteError(const std::vector<double> &values, const std::vector<long double> &reference) {
+    long double max_error = 0.0L;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        max_error = std::max(max_error, std::abs(static_cast<long double>(values[i]) - reference[i]));
+    }
+    return static_cast<double>(max_error);
+}
+
+// Returns whether both the scalar and the SIMD error are within the tier's stated bound
+template<CdfAccuracy Accuracy>
+bool printCdfTierRow(
+    const std::string &label,
+    const std::vector<double> &accuracy_grid,
+    const std::vector<long double> &reference,
+    const std::vector<double> &timing_grid,
+    const double baseline_ns,
+    Benchmark &benchmark
+) {
+    std::vector<double> out(accuracy_grid.size());
+
+    evaluateCdfScalar<Accuracy>(accuracy_grid, out);
+    const double scalar_error = maxAbsoluteError(out, reference);
+    evaluateCdfVectorized<Accuracy>(accuracy_grid, out);
+    const double simd_error = maxAbsoluteError(out, reference);
+    const bool within_bound = scalar_error <= cdfErrorBound(Accuracy) && simd_error <= cdfErrorBound(Accuracy);
+
+    std::vector<double> timing_out(timing_grid.size());
+    const double evaluations = static_cast<double>(timing_grid.size());
+
+    const auto scalar_time = benchmark.run(
+        "CDF_Scalar_" + label,
+        [&]() {
+            evaluateCdfScalar<Accuracy>(timing_grid, timing_out);
+            return timing_out[0];
+        },
+        BenchmarkConfig::CDF_ITERATIONS
+    );
+    const auto simd_time = benchmark.run(
+        "CDF_SIMD_" + label,
+        [&]() {
+            evaluateCdfVectorized<Accuracy>(timing_grid, timing_out);
+            return timing_out[0];
+        },
+        BenchmarkConfig::CDF_ITERATIONS
+    );
+
+    const double scalar_ns = scalar_time.time_per_iteration_microseconds() * 1000.0 / evaluations;
+    const double simd_ns = simd_time.time_per_iteration_microseconds() * 1000.0 / evaluations;
+
+    std::cout << std::left
+            << std::setw(14) << label
+            << std::setw(14) << formatNumber(scalar_error, 2)
+            << std::setw(14) << formatNumber(simd_error, 2)
+            << std::setw(14) << formatNumber(scalar_ns, 2)
+            << std::setw(14) << formatNumber(simd_ns, 2)
+            << std::setw(10) << formatNumber(baseline_ns / simd_ns, 1) + "x"
+            << std::setw(10) << (within_bound ? "ok" : "EXCEEDED")
+            << "\n";
+    return within_bound;
+}
+
+// Returns the number of tiers whose measured error exceeds their stated bound
+int runNormalCdfBenchmark() {
+    printSectionHeader("NORMAL CDF BENCHMARK");
+
+    const double range = BenchmarkConfig::CDF_RANGE;
+
+    std::vector<double> accuracy_grid(BenchmarkConfig::CDF_ACCURACY_POINTS);
+    std::vector<long double> reference(accuracy_grid.size());
+    for (std::size_t i = 0; i < accuracy_grid.size(); ++i) {
+        const double x = -range + 2.0 * range * static_cast<double>(i) / static_cast<double>(accuracy_grid.size() - 1);
+        accuracy_grid[i] = x;
+        reference[i] = 0.5L * std::erfc(-static_cast<long double>(x) / std::sqrt(2.0L));
+    }
+
+    // Timing points cover the range where pricing inputs live
+    std::vector<double> timing_grid(BenchmarkConfig::CDF_TIMING_POINTS);
+    for (std::size_t i = 0; i < timing_grid.size(); ++i) {
+        timing_grid[i] = -8.0 + 16.0 * static_cast<double>(i) / static_cast<double>(timing_grid.size() - 1);
+    }
+
+    Benchmark &benchmark = sharedHarness();
+
+    std::vector<double> out(accuracy_grid.size());
+    for (std::size_t i = 0; i < accuracy_grid.size(); ++i) {
+        out[i] = FinancialMath::normalCDF(accuracy_grid[i]);
+    }
+    const double baseline_error = maxAbsoluteError(out, reference);
+
+    std::vector<double> timing_out(timing_grid.size());
+    const auto baseline = benchmark.run(
+        "CDF_erfc",
+        [&]() {
+            for (std::size_t i = 0; i < timing_grid.size(); ++i) {
+                timing_out[i] = FinancialMath::normalCDF(timing_grid[i]);
+            }
+            return timing_out[0];
+        },
+        BenchmarkConfig::CDF_ITERATIONS
+    );
+    const double baseline_ns = baseline.time_per_iteration_microseconds() * 1000.0
+                               / static_cast<double>(timing_grid.size());
+
+    std::cout << "Max absolute error over [-" << formatNumber(range, 0) << ", " << formatNumber(range, 0)
+            << "] against a long double reference, " << Simd::DoubleVec::width << "-wide SIMD\n\n";
+
+    std::cout << std::left
+            << std::setw(14) << "Tier"
+            << std::setw(14) << "Scalar Err"
+            << std::setw(14) << "SIMD Err"
+            << std::setw(14) << "Scalar ns"
+            << std::setw(14) << "SIMD ns"
+            << std::setw(10) << "vs erfc"
+            << std::setw(10) << "Bound"
+            << "\n";
+    printTableSeparator();
+
+    std::cout << std::left
+            << std::setw(14) << "erfc"
+            << std::setw(14) << formatNumber(baseline_error, 2)
+            << std::setw(14) << "-"
+            << std::setw(14) << formatNumber(baseline_ns, 2)
+            << std::setw(14) << "-"
+            << std::setw(10) << "1.0x"
+            << std::setw(10) << "-"
+            << "\n";
+
+    int violations = 0;
+    violations += !printCdfTierRow<CdfAccuracy::Full>("Full", accuracy_grid, reference, timing_grid, baseline_ns, benchmark);
+    violations += !printCdfTierRow<CdfAccuracy::High>("High", accuracy_grid, reference, timing_grid, baseline_ns, benchmark);
+    violations += !printCdfTierRow<CdfAccuracy::Fast>("Fast", accuracy_grid, reference, timing_grid, baseline_ns, benchmark);
+
+    std::cout << "\nStated bounds: Full " << formatNumber(cdfErrorBound(CdfAccuracy::Full), 1)
+            << ", High " << formatNumber(cdfErrorBound(CdfAccuracy::High), 1)
+            << ", Fast " << formatNumber(cdfErrorBound(CdfAccuracy::Fast), 1) << "\n";
+    return violations;
+}
+
+void runKernelBenchmark() {
+    printSectionHeader("SPECIALIZED KERNELS BENCHMARK");
+
+    const OptionBook book{BenchmarkConfig::BATCH_SIZE};
+    const OptionBatch batch = book.view();
+    const double count = static_cast<double>(batch.size);
+    const BlackScholesEngine engine;
+    const PricingEngine &generic = engine;
+
+    std::vector<Option> options;
+    std::vector<MarketParameters> markets;
+    for (std::size_t i = 0; i < batch.size; ++i) {
+        options.emplace_back(batch.strike[i], batch.type[i], batch.expiry[i]);
+        markets.emplace_back(batch.spot[i], batch.rate[i], batch.volatility[i]);
+    }
+    std::vector<CompactPricingResult> compact_results(batch.size);
+
+    Benchmark &benchmark = sharedHarness();
+
+    // Scalar kernels called directly, the option type resolved per quote as the engine does
+    const auto scalarKernel = [&](auto greeks) {
+        return [&, greeks]() {
+            for (std::size_t i = 0; i < batch.size; ++i) {
+                PricingKernels::withType(batch.type[i], [&](auto type) {
+                    PricingKernels::blackScholes<type(), greeks(), CdfAccuracy::Full>(
+                        batch.spot[i], batch.strike[i], batch.rate[i], batch.volatility[i], batch.expiry[i],
+                        compact_results[i]
+                    );
+                });
+            }
+            return compact_results[0].price;
+        };
+    };
+
+    printSubsectionHeader("Scalar (" + std::to_string(batch.size) + " quotes, mixed calls and puts)");
+    const auto virtual_call = benchmark.run(
+        "Kernel_Scalar_Virtual",
+        [&]() {
+            for (std::size_t i = 0; i < batch.size; ++i) {
+                generic.priceInto(options[i], markets[i], compact_results[i]);
+            }
+            return compact_results[0].price;
+        },
+        BenchmarkConfig::BATCH_ITERATIONS
+    );
+    const auto all_greeks = benchmark.run(
+        "Kernel_Scalar_AllGreeks",
+        scalarKernel(std::integral_constant<unsigned, PricingKernels::ALL_GREEKS>{}),
+        BenchmarkConfig::BATCH_ITERATIONS
+    );
+    const auto price_only = benchmark.run(
+        "Kernel_Scalar_PriceOnly",
+        scalarKernel(std::integral_constant<unsigned, PricingKernels::NO_GREEKS>{}),
+        BenchmarkConfig::BATCH_ITERATIONS
+    );
+
+    const double virtual_time = virtual_call.time_per_iteration_microseconds() / count;
+    std::cout << std::left
+            << std::setw(38) << "Path"
+            << std::setw(16) << "Time/Quote"
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+    const auto printScalarRow = [&](const std::string &label, const BenchmarkResult &result) {
+        const double time = result.time_per_iteration_microseconds() / count;
+        std::cout << std::left
+                << std::setw(38) << label
+                << std::setw(16) << formatMicroseconds(time)
+                << formatNumber(virtual_time / time, 2) + "x"
+                << "\n";
+    };
+    printScalarRow("PricingEngine::priceInto() (virtual)", virtual_call);
+    printScalarRow("Kernel, all Greeks", all_greeks);
+    printScalarRow("Kernel, price only", price_only);
+
+    // Batch kernels: one instantiation per call, chosen by CDF tier, type mix and requested outputs
+    std::vector<Option::Type> calls(batch.size, Option::Type::CALL);
+    OptionBatch call_batch = batch;
+    call_batch.type = calls.data();
+
+    std::vector<double> price(batch.size), delta(batch.size), gamma(batch.size),
+            vega(batch.size), theta(batch.size), rho(batch.size);
+    const BatchResults every_output{price.data(), delta.data(), gamma.data(), vega.data(), theta.data(), rho.data()};
+
+    struct BatchCase {
+        std::string name;
+        std::string label;
+        const OptionBatch *batch;
+        BatchResults results;
+    };
+    const std::vector<BatchCase> cases = {
+        {"Kernel_Batch_MixedAll", "Mixed book, all Greeks", &batch, every_output},
+        {"Kernel_Batch_CallsAll", "Calls only, all Greeks", &call_batch, every_output},
+        {"Kernel_Batch_MixedDelta", "Mixed book, delta only", &batch, BatchResults{price.data(), delta.data()}},
+        {"Kernel_Batch_MixedGamma", "Mixed book, price and gamma", &batch, BatchResults{price.data(), nullptr, gamma.data()}},
+        {"Kernel_Batch_MixedPrice", "Mixed book, price only", &batch, BatchResults{price.data()}}
+    };
+
+    printSubsectionHeader("priceBatch (" + std::to_string(batch.size) + " options, Full CDF)");
+    std::cout << std::left
+            << std::setw(38) << "Book / Outputs"
+            << std::setw(16) << "Time/Option"
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+
+    double baseline_time = 0.0;
+    for (const BatchCase &batch_case: cases) {
+        const auto result = benchmark.run(
+            batch_case.name,
+            [&]() {
+                engine.priceBatch(*batch_case.batch, batch_case.results);
+                return batch_case.results.price[0];
+            },
+            BenchmarkConfig::BATCH_ITERATIONS
+        );
+        const double time = result.time_per_iteration_microseconds() / count;
+        if (baseline_time == 0.0) baseline_time = time;
+
+        std::cout << std::left
+                << std::setw(38) << batch_case.label
+                << std::setw(16) << formatMicroseconds(time)
+                << formatNumber(baseline_time / time, 2) + "x"
+                << "\n";
+    }
+}
+
+void runPrecisionBenchmark() {
+    printSectionHeader("SINGLE PRECISION BENCHMARK");
+
+    // Error grid: every strike x volatility x expiry x rate, calls and puts
+    OptionBook grid{0};
+    for (double strike = 0.5 * BenchmarkConfig::SPOT_PRICE; strike <= 1.5 * BenchmarkConfig::SPOT_PRICE + 1e-9;
+         strike += BenchmarkConfig::PRECISION_STRIKE_STEP) {
+        for (const double volatility: BenchmarkConfig::PRECISION_VOLATILITIES) {
+            for (const double expiry: BenchmarkConfig::PRECISION_EXPIRIES) {
+                for (const double rate: BenchmarkConfig::PRECISION_RATES) {
+                    for (const Option::Type type: {Option::Type::CALL, Option::Type::PUT}) {
+                        grid.strike.push_back(strike);
+                        grid.expiry.push_back(expiry);
+                        grid.type.push_back(type);
+                        grid.spot.push_back(BenchmarkConfig::SPOT_PRICE);
+                        grid.rate.push_back(rate);
+                        grid.volatility.push_back(volatility);
+                    }
+                }
+            }
+        }
+    }
+    const OptionBatch grid_batch = grid.view();
+    const BlackScholesEngine engine;
+
+    constexpr std::size_t outputs = 6;
+    const std::vector<std::string> output_names = {"Price", "Delta", "Gamma", "Vega", "Theta", "Rho"};
+    std::vector<std::vector<double>> expected(outputs, std::vector<double>(grid_batch.size));
+    std::vector<std::vector<double>> actual(outputs, std::vector<double>(grid_batch.size));
+    const auto resultsInto = [](std::vector<std::vector<double>> &columns) {
+        return BatchResults{
+            columns[0].data(), columns[1].data(), columns[2].data(),
+            columns[3].data(), columns[4].data(), columns[5].data()
+        };
+    };
+    engine.priceBatch(grid_batch, resultsInto(expected), Precision::Double);
+    engine.priceBatch(grid_batch, resultsInto(actual), Precision::Single);
+
+    printSubsectionHeader("priceBatch Single vs Double (" + std::to_string(grid_batch.size) + " option grid)");
+    std::cout << std::left
+            << std::setw(14) << "Output"
+            << std::setw(16) << "Max Abs Err"
+            << std::setw(16) << "RMS Err"
+            << "Max Rel Err"
+            << "\n";
+    printTableSeparator();
+    for (std::size_t k = 0; k < outputs; ++k) {
+        double max_absolute = 0.0;
+        double sum_squares = 0.0;
+        double max_relative = 0.0;
+        for (std::size_t i = 0; i < grid_batch.size; ++i) {
+            const double error = std::abs(actual[k][i] - expected[k][i]);
+            max_absolute = std::max(max_absolute, error);
+            sum_squares += error * error;
+            if (std::abs(expected[k][i]) > BenchmarkConfig::PRECISION_RELATIVE_FLOOR) {
+                max_relative = std::max(max_relative, error / std::abs(expected[k][i]));
+            }
+        }
+        std::cout << std::left
+                << std::setw(14) << output_names[k]
+                << std::setw(16) << formatNumber(max_absolute, 2)
+                << std::setw(16) << formatNumber(std::sqrt(sum_squares / static_cast<double>(grid_batch.size)), 2)
+                << formatNumber(max_relative, 2)
+                << "\n";
+    }
+    std::cout << "\nRelative errors count values above " << formatNumber(BenchmarkConfig::PRECISION_RELATIVE_FLOOR, 2)
+            << "; Greeks in BlackScholesEngine units\n";
+
+    // Throughput on the standard book
+    Benchmark &benchmark = sharedHarness();
+    const OptionBook book{BenchmarkConfig::BATCH_SIZE};
+    const OptionBatch batch = book.view();
+    const double count = static_cast<double>(batch.size);
+
+    std::vector<double> price(batch.size), delta(batch.size), gamma(batch.size),
+            vega(batch.size), theta(batch.size), rho(batch.size);
+    const BatchResults every_output{price.data(), delta.data(), gamma.data(), vega.data(), theta.data(), rho.data()};
+
+    struct ThroughputCase {
+        std::string name;
+        std::string label;
+        BatchResults results;
+    };
+    const std::vector<ThroughputCase> cases = {
+        {"AllGreeks", "All Greeks", every_output},
+        {"PriceOnly", "Price only", BatchResults{price.data()}}
+    };
+
+    printSubsectionHeader("priceBatch throughput (" + std::to_string(batch.size) + " options, "
+                          + std::to_string(Simd::DoubleVec::width) + " double / "
+                          + std::to_string(Simd::FloatVec::width) + " float lanes)");
+    std::cout << std::left
+            << std::setw(22) << "Outputs"
+            << std::setw(16) << "Double"
+            << std::setw(16) << "Single"
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+    for (const ThroughputCase &throughput_case: cases) {
+        const auto timePerOption = [&](const std::string &name, const Precision precision) {
+            const auto result = benchmark.run(
+                name,
+                [&]() {
+                    engine.priceBatch(batch, throughput_case.results, precision);
+                    return throughput_case.results.price[0];
+                },
+                BenchmarkConfig::BATCH_ITERATIONS
+            );
+            return result.time_per_iteration_microseconds() / count;
+        };
+        const double double_time = timePerOption("Precision_Batch_Double_" + throughput_case.name, Precision::Double);
+        const double single_time = timePerOption("Precision_Batch_Single_" + throughput_case.name, Precision::Single);
+
+        std::cout << std::left
+                << std::setw(22) << throughput_case.label
+                << std::setw(16) << formatMicroseconds(double_time)
+                << std::setw(16) << formatMicroseconds(single_time)
+                << formatNumber(double_time / single_time, 2) + "x"
+                << "\n";
+    }
+
+    // Monte Carlo: Single draws its own normals, so both precisions are checked against the
+    // analytical price in units of their own standard error; a seed per option keeps the z independent
+    printSubsectionHeader("Monte Carlo against Black-Scholes (" + std::to_string(BenchmarkConfig::PRECISION_MC_PATHS)
+                          + " paths per option)");
+    std::cout << std::left
+            << std::setw(10) << "Mode"
+            << std::setw(10) << "Options"
+            << std::setw(10) << "Mean z"
+            << std::setw(10) << "RMS z"
+            << std::setw(10) << "Max |z|"
+            << std::setw(14) << "Max Delta Err"
+            << std::setw(14) << "Max Vega Err"
+            << "Time/Path"
+            << "\n";
+    printTableSeparator();
+
+    for (const Precision precision: {Precision::Double, Precision::Single}) {
+        const bool single = precision == Precision::Single;
+        unsigned int seed = BenchmarkConfig::RANDOM_SEED;
+
+        int options = 0;
+        double sum_z = 0.0;
+        double sum_squares_z = 0.0;
+        double max_z = 0.0;
+        double max_delta_error = 0.0;
+        double max_vega_error = 0.0;
+        for (const double strike: BenchmarkConfig::PRECISION_MC_STRIKES) {
+            for (const double volatility: BenchmarkConfig::PRECISION_MC_VOLATILITIES) {
+                for (const double expiry: BenchmarkConfig::PRECISION_MC_EXPIRIES) {
+                    for (const Option::Type type: {Option::Type::CALL, Option::Type::PUT}) {
+                        const Option option{strike, type, expiry};
+                        const MarketParameters market{BenchmarkConfig::SPOT_PRICE, BenchmarkConfig::RISK_FREE_RATE, volatility};
+                        const PricingResult analytical = engine.price(option, market);
+                        SimulationParameters params{BenchmarkConfig::PRECISION_MC_PATHS, seed++};
+                        params.precision = precision;
+                        const PricingResult simulated = MonteCarloEngine{params}.price(option, market);
+
+                        // Far out-of-the-money options without a single paying path have no error estimate
+                        const double standard_error = simulated.standard_error.value_or(0.0);
+                        if (standard_error <= 0) continue;
+
+                        const double z = (simulated.price - analytical.price) / standard_error;
+                        ++options;
+                        sum_z += z;
+                        sum_squares_z += z * z;
+                        max_z = std::max(max_z, std::abs(z));
+                        max_delta_error = std::max(max_delta_error,
+                                                   std::abs(simulated.greeks.delta.value() - analytical.greeks.delta.value()));
+                        max_vega_error = std::max(max_vega_error,
+                                                  std::abs(simulated.greeks.vega.value() - analytical.greeks.vega.value()));
+                    }
+                }
+            }
+        }
+
+        SimulationParameters timing_params{BenchmarkConfig::PRECISION_MC_TIMING_PATHS, BenchmarkConfig::RANDOM_SEED};
+        timing_params.precision = precision;
+        const MonteCarloEngine timing_engine{timing_params};
+        const Option option = createTestOption();
+        const MarketParameters market = createTestMarket();
+        const auto timing = benchmark.run(
+            single ? "Precision_MC_Single" : "Precision_MC_Double",
+            [&]() { return timing_engine.price(option, market).price; },
+            BenchmarkConfig::MC_ITERATIONS
+        );
+
+        const double n = static_cast<double>(options);
+        std::cout << std::left
+                << std::setw(10) << (single ? "Single" : "Double")
+                << std::setw(10) << options
+                << std::setw(10) << formatNumber(sum_z / n, 2)
+                << std::setw(10) << formatNumber(std::sqrt(sum_squares_z / n), 2)
+                << std::setw(10) << formatNumber(max_z, 2)
+                << std::setw(14) << formatNumber(max_delta_error, 4)
+                << std::setw(14) << formatNumber(max_vega_error, 4)
+                << formatMicroseconds(timing.time_per_iteration_microseconds()
+                                      / BenchmarkConfig::PRECISION_MC_TIMING_PATHS)
+                << "\n";
+    }
+    std::cout << "\nz = (Monte Carlo - Black-Scholes) / standard error; an unbiased estimator with a trustworthy\n"
+            << "standard error shows mean z near 0 and RMS z near 1. Time/Path from "
+            << BenchmarkConfig::PRECISION_MC_TIMING_PATHS << " paths on the standard option\n";
+}
+
+void runImpliedVolatilityBenchmark() {
+    printSectionHeader("IMPLIED VOLATILITY BENCHMARK");
+
+    // Strikes 50-150% of spot, expiries 0.1-2Y, volatilities 5-95%; quotes are Black-Scholes prices
+    OptionBook book{BenchmarkConfig::IV_BOOK_SIZE};
+    for (std::size_t i = 0; i < book.volatility.size(); ++i) {
+        book.volatility[i] = 0.05 + 0.025 * static_cast<double>(i % 37);
+    }
+    const OptionBatch batch = book.view();
+
+    std::vector<double> prices(batch.size);
+    BlackScholesEngine{}.priceBatch(batch, BatchResults{prices.data()});
+
+    const ImpliedVolatilityBatch quotes{
+        prices.data(), book.strike.data(), book.expiry.data(), book.type.data(),
+        book.spot.data(), book.rate.data(), batch.size
+    };
+
+    std::vector<double> volatilities(batch.size);
+    std::vector<ImpliedVolatilityStatus> statuses(batch.size);
+    std::vector<int> iterations(batch.size);
+    const ImpliedVolatilityResults results{volatilities.data(), statuses.data(), iterations.data()};
+
+    const ImpliedVolatilitySolver solver;
+    Benchmark &benchmark = sharedHarness();
+
+    const auto scalar_result = benchmark.run(
+        "IV_Scalar",
+        [&]() {
+            for (std::size_t i = 0; i < batch.size; ++i) {
+                const Option option{book.strike[i], book.type[i], book.expiry[i]};
+                volatilities[i] = solver.solve(option, prices[i], book.spot[i], book.rate[i]).volatility;
+            }
+            return volatilities[0];
+        },
+        BenchmarkConfig::IV_ITERATIONS
+    );
+
+    const auto batch_result = benchmark.run(
+        "IV_Batch",
+        [&]() {
+            solver.solveBatch(quotes, results);
+            return volatilities[0];
+        },
+        BenchmarkConfig::IV_ITERATIONS
+    );
+
+    std::size_t converged = 0;
+    std::size_t total_iterations = 0;
+    int max_iterations = 0;
+    double max_error = 0.0;
+    for (std::size_t i = 0; i < batch.size; ++i) {
+        if (statuses[i] != ImpliedVolatilityStatus::Converged) continue;
+        ++converged;
+        total_iterations += static_cast<std::size_t>(iterations[i]);
+        max_iterations = std::max(max_iterations, iterations[i]);
+
+        const double discounted_strike = book.strike[i] * std::exp(-book.rate[i] * book.expiry[i]);
+        const double intrinsic = book.type[i] == Option::Type::CALL
+                                     ? std::max(book.spot[i] - discounted_strike, 0.0)
+                                     : std::max(discounted_strike - book.spot[i], 0.0);
+        if (prices[i] - intrinsic >= BenchmarkConfig::IV_MIN_TIME_VALUE * book.spot[i]) {
+            max_error = std::max(max_error, std::abs(volatilities[i] - book.volatility[i]) / book.volatility[i]);
+        }
+    }
+
+    const double options = static_cast<double>(batch.size);
+    const double mean_iterations = static_cast<double>(total_iterations) / static_cast<double>(std::max<std::size_t>(converged, 1));
+
+    std::cout << batch.size << " quotes, " << converged << " converged, mean "
+            << formatNumber(mean_iterations, 2) << " / max " << max_iterations << " iterations\n";
+    std::cout << "Max relative volatility error (time value >= "
+            << std::scientific << std::setprecision(0) << BenchmarkConfig::IV_MIN_TIME_VALUE << std::fixed
+            << " x spot): " << formatNumber(max_error, 2) << "\n\n";
+
+    std::cout << std::left
+            << std::setw(20) << "Method"
+            << std::setw(15) << "Total Time"
+            << std::setw(15) << "ns/Option"
+            << std::setw(18) << "Options/Second"
+            << std::setw(10) << "Speedup"
+            << "\n";
+    printTableSeparator();
+
+    const double scalar_time = scalar_result.time_per_iteration_microseconds();
+    auto printRow = [&](const std::string &label, const double time) {
+        std::cout << std::left
+                << std::setw(20) << label
+                << std::setw(15) << formatMicroseconds(time)
+                << std::setw(15) << formatNumber(time * 1000.0 / options, 1)
+                << std::setw(18) << formatNumber(options / (time / 1000000.0), 2)
+                << std::setw(10) << formatNumber(scalar_time / time, 2) + "x"
+                << "\n";
+    };
+
+    printRow("Scalar solve()", scalar_time);
+    printRow("solveBatch()", batch_result.time_per_iteration_microseconds());
+}
+
+// Continuously monitored down-and-out call, barrier below the strike, no rebate (Merton 1973)
+double continuousDownAndOutCall(const Option &call, const MarketParameters &market, const double barrier) {
+    const double spot = market.spot_price;
+    const double strike = call.getStrike();
+    const double rate = market.risk_free_rate;
+    const double volatility = market.volatility;
+    const double expiry = call.getExpiry();
+    const double total_volatility = volatility * std::sqrt(expiry);
+
+    const double lambda = (rate + 0.5 * volatility * volatility) / (volatility * volatility);
+    const double y = std::log(barrier * barrier / (spot * strike)) / total_volatility + lambda * total_volatility;
+    const double down_and_in = spot * std::pow(barrier / spot, 2.0 * lambda) * FinancialMath::normalCDF(y)
+                               - strike * std::exp(-rate * expiry) * std::pow(barrier / spot, 2.0 * lambda - 2.0)
+                               * FinancialMath::normalCDF(y - total_volatility);
+
+    return BlackScholesEngine{}.price(call, market).price - down_and_in;
+}
+
+void runPathDependentBenchmark() {
+    printSectionHeader("PATH-DEPENDENT OPTIONS BENCHMARK");
+
+    const auto call = createTestOption();
+    const auto market = createTestMarket();
+    using Style = PathDependentOption::Style;
+
+    const double down_and_out = continuousDownAndOutCall(call, market, BenchmarkConfig::DOWN_BARRIER);
+    const double european = BlackScholesEngine{}.price(call, market).price;
+
+    std::cout << "Paths: " << BenchmarkConfig::PATH_PATHS
+            << ", barriers: down " << formatNumber(BenchmarkConfig::DOWN_BARRIER, 0)
+            << ", up " << formatNumber(BenchmarkConfig::UP_BARRIER, 0) << "\n";
+    std::cout << "References: discrete geometric Asian closed form, continuous down barrier closed form\n\n";
+
+    std::cout << std::left
+            << std::setw(22) << "Product"
+            << std::setw(8) << "Steps"
+            << std::setw(12) << "Price"
+            << std::setw(12) << "Std Error"
+            << std::setw(12) << "Reference"
+            << std::setw(12) << "|Err|/SE"
+            << std::setw(14) << "Time"
+            << "\n";
+    printTableSeparator();
+
+    Benchmark &benchmark = sharedHarness();
+
+    for (const int steps: BenchmarkConfig::PATH_STEPS) {
+        const PathSimulationEngine engine{
+            PathSimulationParameters{BenchmarkConfig::PATH_PATHS, steps, BenchmarkConfig::RANDOM_SEED}
+        };
+
+        const auto printRow = [&](const std::string &label, const PathDependentOption &option, const double reference) {
+            const auto timing = benchmark.run(
+                "Path_" + label + "_" + std::to_string(steps),
+                [&]() { return engine.price(option, market).price; },
+                BenchmarkConfig::PATH_ITERATIONS
+            );
+            const auto result = engine.price(option, market);
+            const double standard_error = result.standard_error.value();
+            const bool has_reference = !std::isnan(reference);
+
+            std::cout << std::left
+                    << std::setw(22) << label
+                    << std::setw(8) << steps
+                    << std::setw(12) << formatNumber(result.price, BenchmarkConfig::PRICE_PRECISION)
+                    << std::setw(12) << formatNumber(standard_error, BenchmarkConfig::PRICE_PRECISION)
+                    << std::setw(12) << (has_reference ? formatNumber(reference, BenchmarkConfig::PRICE_PRECISION) : "-")
+                    << std::setw(12) << (has_reference ? formatNumber(std::abs(result.price - reference) / standard_error) : "-")
+                    << std::setw(14) << formatMicroseconds(timing.time_per_iteration_microseconds())
+                    << "\n";
+            return result.price;
+        };
+
+        constexpr double none = std::numeric_limits<double>::quiet_NaN();
+        printRow("Geometric Asian", PathDependentOption{call, Style::GeometricAsian},
+                 PathSimulationEngine::geometricAsianPrice(call, market, steps));
+        printRow("Arithmetic Asian", PathDependentOption{call, Style::ArithmeticAsian}, none);
+        const double out = printRow("Down-and-Out", PathDependentOption{call, Style::DownAndOut, BenchmarkConfig::DOWN_BARRIER},
+                                    down_and_out);
+        const double in = printRow("Down-and-In", PathDependentOption{call, Style::DownAndIn, BenchmarkConfig::DOWN_BARRIER},
+                                   european - down_and_out);
+        printRow("Up-and-Out", PathDependentOption{call, Style::UpAndOut, BenchmarkConfig::UP_BARRIER}, none);
+
+        // In + out pay the vanilla on every path, so parity holds on the same draws to rounding
+        const double vanilla = engine.price(call, market).price;
+        std::cout << std::left << std::setw(30) << "  In + Out - European" << formatNumber(out + in - vanilla, 2) << "\n";
+    }
+}
+
+void runLatticeBenchmark() {
+    printSectionHeader("AMERICAN OPTIONS (LATTICE) BENCHMARK");
+
+    const Option put{BenchmarkConfig::STRIKE_PRICE, Option::Type::PUT, BenchmarkConfig::TIME_TO_EXPIRY};
+    const auto market = createTestMarket();
+    const auto analytical = BlackScholesEngine{}.price(put, market);
+
+    std::cout << "American put; 'Euro Err' is the same lattice without early exercise minus Black-Scholes\n\n";
+    std::cout << std::left
+            << std::setw(16) << "Lattice"
+            << std::setw(8) << "Steps"
+            << std::setw(12) << "Price"
+            << std::setw(12) << "Euro Err"
+            << std::setw(11) << "Delta"
+            << std::setw(11) << "Gamma"
+            << std::setw(11) << "Theta"
+            << "Time"
+            << "\n";
+    printTableSeparator();
+
+    const std::vector<std::pair<std::string, LatticeType>> lattices = {
+        {"CRR", LatticeType::CoxRossRubinstein},
+        {"Leisen-Reimer", LatticeType::LeisenReimer},
+        {"Trinomial", LatticeType::Trinomial}
+    };
+
+    Benchmark &benchmark = sharedHarness();
+    for (const auto &[label, type]: lattices) {
+        for (const int steps: BenchmarkConfig::LATTICE_STEPS) {
+            const LatticeEngine american{LatticeParameters{steps, type, ExerciseStyle::American}};
+            const LatticeEngine european{LatticeParameters{steps, type, ExerciseStyle::European}};
+
+            const auto timing = benchmark.run(
+                "Lattice_" + label + "_" + std::to_string(steps),
+                [&]() { return american.price(put, market).price; },
+                BenchmarkConfig::LATTICE_ITERATIONS
+            );
+            const auto result = american.price(put, market);
+            const double european_error = european.price(put, market).price - analytical.price;
+
+            std::cout << std::left
+                    << std::setw(16) << label
+                    << std::setw(8) << american.getLatticeParameters().num_steps
+                    << std::setw(12) << formatNumber(result.price, BenchmarkConfig::GREEKS_PRECISION)
+                    << std::setw(12) << formatNumber(european_error, 2)
+                    << std::setw(11) << formatNumber(result.greeks.delta.value(), 5)
+                    << std::setw(11) << formatNumber(result.greeks.gamma.value(), 5)
+                    << std::setw(11) << formatNumber(result.greeks.theta.value(), 5)
+                    << formatMicroseconds(timing.time_per_iteration_microseconds())
+                    << "\n";
+        }
+    }
+
+    std::cout << "\nBlack-Scholes European put: " << formatNumber(analytical.price, BenchmarkConfig::GREEKS_PRECISION)
+            << " (delta " << formatNumber(analytical.greeks.delta.value(), 5)
+            << ", gamma " << formatNumber(analytical.greeks.gamma.value(), 5)
+            << ", theta " << formatNumber(analytical.greeks.theta.value(), 5) << ")\n";
+}
+
+void runPdeBenchmark() {
+    printSectionHeader("CRANK-NICOLSON PDE BENCHMARK");
+
+    const Option put{BenchmarkConfig::STRIKE_PRICE, Option::Type::PUT, BenchmarkConfig::TIME_TO_EXPIRY};
+    const auto market = createTestMarket();
+    const auto analytical = BlackScholesEngine{}.price(put, market);
+    const double american_reference = LatticeEngine{
+        LatticeParameters{BenchmarkConfig::PDE_REFERENCE_STEPS, LatticeType::LeisenReimer}
+    }.price(put, market).price;
+
+    printSubsectionHeader("Single Put (European vs Black-Scholes, American vs "
+                          + std::to_string(BenchmarkConfig::PDE_REFERENCE_STEPS) + "-step Leisen-Reimer)");
+    std::cout << std::left
+            << std::setw(12) << "Grid"
+            << std::setw(12) << "Euro Err"
+            << std::setw(12) << "Delta Err"
+            << std::setw(12) << "Gamma Err"
+            << std::setw(12) << "Theta Err"
+            << std::setw(12) << "Amer Err"
+            << "Time (Amer)"
+            << "\n";
+    printTableSeparator();
+
+    Benchmark &benchmark = sharedHarness();
+    for (const int time_steps: BenchmarkConfig::PDE_TIME_STEPS) {
+        const int space_steps = 2 * time_steps;
+        const PdeEngine european{PdeParameters{space_steps, time_steps, ExerciseStyle::European}};
+        const PdeEngine american{PdeParameters{space_steps, time_steps, ExerciseStyle::American}};
+
+        const auto timing = benchmark.run(
+            "PDE_" + std::to_string(time_steps),
+            [&]() { return american.price(put, market).price; },
+            BenchmarkConfig::PDE_ITERATIONS
+        );
+        const auto result = european.price(put, market);
+
+        std::cout << std::left
+                << std::setw(12) << std::to_string(space_steps) + "x" + std::to_string(time_steps)
+                << std::setw(12) << formatNumber(result.price - analytical.price)
+                << std::setw(12) << formatNumber(result.greeks.delta.value() - analytical.greeks.delta.value())
+                << std::setw(12) << formatNumber(result.greeks.gamma.value() - analytical.greeks.gamma.value())
+                << std::setw(12) << formatNumber(result.greeks.theta.value() - analytical.greeks.theta.value())
+                << std::setw(12) << formatNumber(american.price(put, market).price - american_reference, 4)
+                << formatMicroseconds(timing.time_per_iteration_microseconds())
+                << "\n";
+    }
+
+    // A call checks the upper boundary, which a put barely sees; parity ties the two solves together
+    const Option call{BenchmarkConfig::STRIKE_PRICE, Option::Type::CALL, BenchmarkConfig::TIME_TO_EXPIRY};
+    const auto analytical_call = BlackScholesEngine{}.price(call, market);
+    const double forward_intrinsic = market.spot_price
+                                     - put.getStrike() * std::exp(-market.risk_free_rate * put.getExpiry());
+
+    printSubsectionHeader("European Call and Put-Call Parity (C - P - (S - K e^{-rT}))");
+    std::cout << std::left
+            << std::setw(12) << "Grid"
+            << std::setw(12) << "Call Err"
+            << std::setw(12) << "Delta Err"
+            << std::setw(12) << "Gamma Err"
+            << std::setw(12) << "Put Err"
+            << "Parity Err"
+            << "\n";
+    printTableSeparator();
+
+    for (const int time_steps: BenchmarkConfig::PDE_TIME_STEPS) {
+        const int space_steps = 2 * time_steps;
+        const PdeEngine european{PdeParameters{space_steps, time_steps, ExerciseStyle::European}};
+        const auto call_result = european.price(call, market);
+        const auto put_result = european.price(put, market);
+
+        std::cout << std::left
+                << std::setw(12) << std::to_string(space_steps) + "x" + std::to_string(time_steps)
+                << std::setw(12) << formatNumber(call_result.price - analytical_call.price)
+                << std::setw(12) << formatNumber(call_result.greeks.delta.value() - analytical_call.greeks.delta.value())
+                << std::setw(12) << formatNumber(call_result.greeks.gamma.value() - analytical_call.greeks.gamma.value())
+                << std::setw(12) << formatNumber(put_result.price - analytical.price)
+                << formatNumber(call_result.price - put_result.price - forward_intrinsic)
+                << "\n";
+    }
+
+    // Strikes 70-130% of spot at every grid expiry, from one solve
+    std::vector<double> strikes(BenchmarkConfig::PDE_GRID_STRIKES);
+    for (std::size_t k = 0; k < strikes.size(); ++k) {
+        strikes[k] = BenchmarkConfig::SPOT_PRICE * (0.7 + 0.6 * static_cast<double>(k) / static_cast<double>(strikes.size() - 1));
+    }
+    const std::vector<double> &expiries = BenchmarkConfig::PDE_GRID_EXPIRIES;
+    const std::size_t grid_size = strikes.size() * expiries.size();
+
+    const int time_steps = BenchmarkConfig::PDE_TIME_STEPS.back();
+    const PdeEngine engine{PdeParameters{2 * time_steps, time_steps}};
+    std::vector<double> prices(grid_size);
+
+    printSubsectionHeader("Strike x Expiry Grid (" + std::to_string(strikes.size()) + " x "
+                          + std::to_string(expiries.size()) + " calls, "
+                          + std::to_string(2 * time_steps) + "x" + std::to_string(time_steps) + " grid)");
+
+    const auto grid_timing = benchmark.run(
+        "PDE_Grid",
+        [&]() {
+            engine.priceGrid(Option::Type::CALL, strikes.data(), strikes.size(), expiries.data(), expiries.size(),
+                             market, BatchResults{prices.data()});
+            return prices[0];
+        },
+        BenchmarkConfig::PDE_ITERATIONS
+    );
+    const auto single_timing = benchmark.run(
+        "PDE_Single",
+        [&]() {
+            double total = 0.0;
+            for (const double expiry: expiries) {
+                for (const double strike: strikes) {
+                    total += engine.price(Option{strike, Option::Type::CALL, expiry}, market).price;
+                }
+            }
+            return total;
+        },
+        1
+    );
+
+    double max_error = 0.0;
+    for (std::size_t e = 0; e < expiries.size(); ++e) {
+        for (std::size_t k = 0; k < strikes.size(); ++k) {
+            const double reference = BlackScholesEngine{}.price(Option{strikes[k], Option::Type::CALL, expiries[e]}, market).price;
+            max_error = std::max(max_error, std::abs(prices[e * strikes.size() + k] - reference));
+        }
+    }
+
+    std::cout << "One solve (priceGrid):   " << formatMicroseconds(grid_timing.time_per_iteration_microseconds()) << "\n";
+    std::cout << "One solve per option:    " << formatMicroseconds(single_timing.time_per_iteration_microseconds())
+            << " (" << formatNumber(single_timing.time_per_iteration_microseconds() / grid_timing.time_per_iteration_microseconds(), 1)
+            << "x slower)\n";
+    std::cout << "Max error vs Black-Scholes: " << formatNumber(max_error, 2) << "\n";
+}
+
+void runScenarioGridBenchmark() {
+    printSectionHeader("SCENARIO GRID (P&L CUBE) BENCHMARK");
+
+    ScenarioAxes axes;
+    for (int step = -BenchmarkConfig::GRID_SPOT_STEPS; step <= BenchmarkConfig::GRID_SPOT_STEPS; ++step) {
+        axes.spot_shifts.push_back(0.01 * step);
+    }
+    for (int step = -BenchmarkConfig::GRID_VOL_STEPS; step <= BenchmarkConfig::GRID_VOL_STEPS; ++step) {
+        axes.vol_shifts.push_back(0.01 * step);
+    }
+    for (const double days: BenchmarkConfig::GRID_ELAPSED_DAYS) {
+        axes.time_shifts.push_back(days / 365.0);
+    }
+
+    const OptionBook book{BenchmarkConfig::GRID_BOOK_SIZE};
+    const OptionBatch batch = book.view();
+    std::vector<double> quantities(batch.size);
+    for (std::size_t i = 0; i < quantities.size(); ++i) {
+        quantities[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    std::cout << "Book: " << batch.size << " options, grid: " << axes.spot_shifts.size() << " spots x "
+            << axes.vol_shifts.size() << " vols x " << axes.time_shifts.size() << " times = "
+            << axes.size() << " scenarios\n";
+
+    // Nested price() loops over a sample of the book, the baseline this engine replaces
+    const BlackScholesEngine bs_engine;
+    OptionBatch sample = batch;
+    sample.size = BenchmarkConfig::GRID_NESTED_SAMPLE;
+    std::vector<double> nested(axes.size(), 0.0);
+
+    Benchmark &benchmark = sharedHarness();
+    const auto nested_result = benchmark.run(
+        "Grid_Nested",
+        [&]() {
+            std::fill(nested.begin(), nested.end(), 0.0);
+            for (std::size_t i = 0; i < sample.size; ++i) {
+                const Option option{batch.strike[i], batch.type[i], batch.expiry[i]};
+                const double base = bs_engine.price(option, MarketParameters{batch.spot[i], batch.rate[i], batch.volatility[i]}).price;
+
+                std::size_t n = 0;
+                for (const double elapsed: axes.time_shifts) {
+                    const Option aged{batch.strike[i], batch.type[i], batch.expiry[i] - elapsed};
+                    for (const double vol_shift: axes.vol_shifts) {
+                        for (const double spot_shift: axes.spot_shifts) {
+                            const MarketParameters market{
+                                batch.spot[i] * (1.0 + spot_shift), batch.rate[i], batch.volatility[i] + vol_shift
+                            };
+                            const double value = aged.getExpiry() > 0 ? bs_engine.price(aged, market).price
+                                                                      : aged.payoff(market.spot_price);
+                            nested[n++] += quantities[i] * (value - base);
+                        }
+                    }
+                }
+            }
+            return nested[0];
+        },
+        1
+    );
+
+    const ScenarioGridEngine sample_engine;
+    const PnlCube sample_cube = sample_engine.run(sample, quantities.data(), axes);
+    double max_difference = 0.0;
+    for (std::size_t n = 0; n < nested.size(); ++n) {
+        max_difference = std::max(max_difference, std::abs(sample_cube.values()[n] - nested[n]));
+    }
+
+    const double scenario_count = static_cast<double>(axes.size());
+    const double nested_per_point = nested_result.time_per_iteration_microseconds()
+                                    / (scenario_count * static_cast<double>(sample.size));
+
+    std::cout << "\n" << std::left
+            << std::setw(28) << "Method"
+            << std::setw(16) << "Time"
+            << std::setw(20) << "Per Option x Scen."
+            << "Speedup"
+            << "\n";
+    printTableSeparator();
+    std::cout << std::left
+            << std::setw(28) << "Nested price() (sample)"
+            << std::setw(16) << formatMicroseconds(nested_result.time_per_iteration_microseconds())
+            << std::setw(20) << formatMicroseconds(nested_per_point)
+            << "1.0x"
+            << "\n";
+
+    std::vector<unsigned int> thread_counts = {1};
+    if (ThreadPool::hardwareThreads() > 1) thread_counts.push_back(ThreadPool::hardwareThreads());
+
+    for (const unsigned int threads: thread_counts) {
+        const ScenarioGridEngine engine{threads};
+        const auto result = benchmark.run(
+            "Grid_Cube_" + std::to_string(threads),
+            [&]() { return engine.run(batch, quantities.data(), axes).at(0, 0, 0); },
+            1
+        );
+        const double per_point = result.time_per_iteration_microseconds()
+                                 / (scenario_count * static_cast<double>(batch.size));
+
+        std::cout << std::left
+                << std::setw(28) << "Cube, " + std::to_string(threads) + " thread(s)"
+                << std::setw(16) << formatMicroseconds(result.time_per_iteration_microseconds())
+                << std::setw(20) << formatMicroseconds(per_point)
+                << formatNumber(nested_per_point / per_point, 1) + "x"
+                << "\n";
+    }
+
+    std::cout << "\nMax |cube - nested| on the sample: " << formatNumber(max_difference, 2) << "\n";
+}
+
+void printScalingHeader() {
+    std::cout << std::left
+            << std::setw(10) << "Threads"
+            << std::setw(16) << "Time/Run"
+            << std::setw(20) << "Throughput"
+            << std::setw(12) << "Speedup"
+            << std::setw(12) << "Efficiency"
+            << "\n";
+    printTableSeparator();
+}
+
+// Throughput in millions of units per second; efficiency is speedup per thread
+void printScalingRow(
+    const unsigned int threads,
+    const double time_microseconds,
+    const double units,
+    const std::string &unit,
+    const double single_thread_microseconds
+) {
+    const double speedup = single_thread_microseconds / time_microseconds;
+
+    std::cout << std::left
+            << std::setw(10) << threads
+            << std::setw(16) << formatMicroseconds(time_microseconds)
+            << std::setw(20) << formatNumber(units / time_microseconds, 2) + " M " + unit + "/s"
+            << std::setw(12) << formatNumber(speedup, 2) + "x"
+            << std::setw(12) << formatNumber(100.0 * speedup / threads, 1) + "%"
+            << "\n";
+}
+
+void runScalingBenchmark(const std::vector<unsigned int> &thread_counts) {
+    printSectionHeader("SCALING BENCHMARK");
+
+    Benchmark &benchmark = sharedHarness();
+    const BlackScholesEngine bs_engine;
+
+    printSubsectionHeader("Batch Size (Black-Scholes batch with Greeks, 1 thread)");
+
+    std::cout << std::left
+            << std::setw(12) << "Options"
+            << std::setw(16) << "Time/Batch"
+            << std::setw(16) << "Per Option"
+            << std::setw(20) << "Throughput"
+            << "\n";
+    printTableSeparator();
+
+    {
+        const OptionBook book{BenchmarkConfig::SCALING_BATCH_SIZES.back()};
+        std::vector<double> prices(book.strike.size()), deltas(book.strike.size()), gammas(book.strike.size());
+        std::vector<double> vegas(book.strike.size()), thetas(book.strike.size()), rhos(book.strike.size());
+        const BatchResults results{
+            prices.data(), deltas.data(), gammas.data(), vegas.data(), thetas.data(), rhos.data()
+        };
+
+        for (const std::size_t size: BenchmarkConfig::SCALING_BATCH_SIZES) {
+            OptionBatch batch = book.view();
+            batch.size = size;
+            const int iterations = static_cast<int>(std::max<std::size_t>(
+                BenchmarkConfig::SCALING_OPTIONS_PER_SAMPLE / size, 1));
+
+            const auto result = benchmark.run(
+                "Scaling_Batch_" + std::to_string(size),
+                [&]() {
+                    bs_engine.priceBatch(batch, results);
+                    return prices[0];
+                },
+                iterations
+            );
+            const double batch_time = result.time_per_iteration_microseconds();
+            const double per_option = batch_time / static_cast<double>(size);
+
+            std::cout << std::left
+                    << std::setw(12) << size
+                    << std::setw(16) << formatMicroseconds(batch_time)
+                    << std::setw(16) << formatMicroseconds(per_option)
+                    << std::setw(20) << formatNumber(1.0 / per_option, 2) + " M options/s"
+                    << "\n";
+        }
+    }
+
+    printSubsectionHeader("Threads: Black-Scholes batch with Greeks ("
+                          + std::to_string(BenchmarkConfig::SCALING_THREAD_BOOK_SIZE) + " options)");
+    printScalingHeader();
+
+    {
+        const OptionBook book{BenchmarkConfig::SCALING_THREAD_BOOK_SIZE};
+        const OptionBatch batch = book.view();
+        std::vector<double> prices(batch.size), deltas(batch.size), gammas(batch.size);
+        std::vector<double> vegas(batch.size), thetas(batch.size), rhos(batch.size);
+
+        const std::size_t chunk = BenchmarkConfig::SCALING_CHUNK_SIZE;
+        const std::size_t chunks = (batch.size + chunk - 1) / chunk;
+        double single_thread_time = 0;
+
+        for (const unsigned int threads: thread_counts) {
+            ThreadPool pool{threads};
+
+            const auto result = benchmark.run(
+                "Scaling_BS_Threads_" + std::to_string(threads),
+                [&]() {
+                    pool.parallelFor(chunks, [&](const std::size_t c) {
+                        const std::size_t offset = c * chunk;
+                        OptionBatch part = batch;
+                        part.strike += offset;
+                        part.expiry += offset;
+                        part.type += offset;
+                        part.spot += offset;
+                        part.rate += offset;
+                        part.volatility += offset;
+                        part.size = std::min(chunk, batch.size - offset);
+
+                        bs_engine.priceBatch(part, BatchResults{
+                            prices.data() + offset, deltas.data() + offset, gammas.data() + offset,
+                            vegas.data() + offset, thetas.data() + offset, rhos.data() + offset
+                        });
+                    });
+                    return prices[0];
+                },
+                1
+            );
+
+            const double time = result.time_per_iteration_microseconds();
+            if (threads == 1) single_thread_time = time;
+            printScalingRow(threads, time, static_cast<double>(batch.size), "options", single_thread_time);
+        }
+    }
+
+    const auto call = createTestOption();
+    const auto market = createTestMarket();
+
+    for (const bool greeks: {false, true}) {
+        const std::string label = greeks ? "Greeks" : "Price";
+        printSubsectionHeader("Threads: Monte Carlo " + std::string{greeks ? "price with pathwise Greeks" : "price only"}
+                              + " (" + std::to_string(BenchmarkConfig::SCALING_PATHS) + " paths)");
+        printScalingHeader();
+
+        double single_thread_time = 0;
+
+        for (const unsigned int threads: thread_counts) {
+            SimulationParameters params{BenchmarkConfig::SCALING_PATHS, BenchmarkConfig::RANDOM_SEED, threads};
+            params.compute_greeks = greeks;
+            const MonteCarloEngine engine{params};
+
+            const auto result = benchmark.run(
+                "Scaling_MC_" + label + "_Threads_" + std::to_string(threads),
+                [&]() { return engine.price(call, market).price; },
+                1
+            );
+
+            const double time = result.time_per_iteration_microseconds();
+            if (threads == 1) single_thread_time = time;
+            printScalingRow(threads, time, BenchmarkConfig::SCALING_PATHS, "paths", single_thread_time);
+        }
+    }
+}
+
+// Writes book as `spot,strike,rate,vol,expiry,type` rows with a header
+void writeCsvBook(const std::string &path, const OptionBatch &book) {
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file{std::fopen(path.c_str(), "wb"), &std::fclose};
+    if (!file) throw std::runtime_error("Cannot create " + path);
+
+    std::string text = "spot,strike,rate,vol,expiry,type\n";
+    char field[32];
+    for (std::size_t i = 0; i < book.size; ++i) {
+        for (const double value: {book.spot[i], book.strike[i], book.rate[i], book.volatility[i], book.expiry[i]}) {
+            text.append(field, std::to_chars(field, field + sizeof(field), value).ptr);
+            text += ',';
+        }
+        text += book.type[i] == Option::Type::CALL ? "call\n" : "put\n";
+
+        if (text.size() > (1 << 20) || i + 1 == book.size) {
+            if (std::fwrite(text.data(), 1, text.size(), file.get()) != text.size()) {
+                throw std::runtime_error("Failed writing " + path);
+            }
+            text.clear();
+        }
+    }
+}
+
+void runColumnarBenchmark() {
+    printSectionHeader("COLUMNAR BOOK BENCHMARK");
+
+    namespace fs = std::filesystem;
+    const fs::path directory = fs::temp_directory_path();
+    const std::string stem = "option_pricing_bench_" + std::to_string(BenchmarkConfig::RANDOM_SEED);
+    const std::string csv_path = (directory / (stem + "_book.csv")).string();
+    const std::string csv_out_path = (directory / (stem + "_results.csv")).string();
+    const std::string book_path = (directory / (stem + "_book.bin")).string();
+    const std::string results_path = (directory / (stem + "_results.bin")).string();
+
+    {
+        const OptionBook book{BenchmarkConfig::COLUMNAR_OPTIONS};
+        writeCsvBook(csv_path, book.view());
+    }
+
+    Benchmark &benchmark = sharedHarness();
+    SamplingOptions single_run;
+    single_run.warmup_runs = 0;
+    single_run.min_samples = 1;
+    single_run.max_samples = 1;
+    single_run.min_time_ms = 0;
+
+    const auto convert = benchmark.run(
+        "Columnar_Convert",
+        [&]() { return static_cast<double>(ColumnarFile::convertCsv(csv_path, book_path).size()); },
+        1, single_run
+    );
+
+    const BatchPricer pricer{BatchPricerParameters{BatchMethod::BlackScholes, 1, 0}};
+    const auto text = benchmark.run(
+        "Columnar_Text_Path",
+        [&]() {
+            const std::unique_ptr<std::FILE, int (*)(std::FILE *)> input{std::fopen(csv_path.c_str(), "rb"), &std::fclose};
+            const std::unique_ptr<std::FILE, int (*)(std::FILE *)> output{std::fopen(csv_out_path.c_str(), "wb"), &std::fclose};
+            if (!input || !output) throw std::runtime_error("Cannot open benchmark files");
+            return static_cast<double>(pricer.run(input.get(), output.get()).options);
+        },
+        1, single_run
+    );
+    const auto binary = benchmark.run(
+        "Columnar_Binary_Path",
+        [&]() { return static_cast<double>(pricer.priceBook(book_path, results_path).options); },
+        1, single_run
+    );
+
+    // Both paths price the same book with the same kernel; compare the leading rows
+    double max_difference = 0;
+    {
+        const ColumnarFile results = ColumnarFile::open(results_path);
+        const auto *prices = static_cast<const double *>(results.column(ColumnId::Price));
+        const std::unique_ptr<std::FILE, int (*)(std::FILE *)> text_results{std::fopen(csv_out_path.c_str(), "rb"), &std::fclose};
+
+        char line[512];
+        std::fgets(line, sizeof(line), text_results.get());
+        for (std::size_t i = 0; i < std::min<std::size_t>(results.size(), 100000); ++i) {
+            if (!std::fgets(line, sizeof(line), text_results.get())) break;
+            const char *price = std::strchr(line, ',') + 1;
+            max_difference = std::max(max_difference, std::abs(std::strtod(price, nullptr) - prices[i]));
+        }
+    }
+
+    const auto file_size = [](const std::string &path) { return static_cast<double>(fs::file_size(path)) / 1e6; };
+
+    std::cout << std::left
+            << std::setw(34) << "Path"
+            << std::setw(14) << "Time"
+            << std::setw(18) << "Options/s"
+            << std::setw(14) << "In / Out MB"
+            << "\n";
+    printTableSeparator();
+
+    const auto row = [&](const std::string &label, const BenchmarkResult &result, const std::string &input,
+                         const std::string &output) {
+        const double seconds = result.time_per_iteration_microseconds() / 1e6;
+        std::cout << std::left
+                << std::setw(34) << label
+                << std::setw(14) << formatMicroseconds(result.time_per_iteration_microseconds())
+                << std::setw(18) << formatNumber(BenchmarkConfig::COLUMNAR_OPTIONS / seconds / 1e6, 2) + " M"
+                << std::setw(14) << formatNumber(file_size(input), 0) + " / " + formatNumber(file_size(output), 0)
+                << "\n";
+    };
+    row("Text (parse, price, format)", text, csv_path, csv_out_path);
+    row("Columnar (mmap, price in place)", binary, book_path, results_path);
+
+    std::cout << "\nOptions:              " << BenchmarkConfig::COLUMNAR_OPTIONS << "\n";
+    std::cout << "CSV -> columnar:      " << formatMicroseconds(convert.time_per_iteration_microseconds()) << " (one-off)\n";
+    std::cout << "Speedup:              "
+            << formatNumber(text.time_per_iteration_microseconds() / binary.time_per_iteration_microseconds(), 1) << "x\n";
+    std::cout << "Max |text - columnar| price on a sample: " << formatNumber(max_difference, 2) << "\n";
+
+    for (const std::string &path: {csv_path, csv_out_path, book_path, results_path}) {
+        fs::remove(path);
+    }
+}
+
+void runServerBenchmark() {
+    printSectionHeader("PRICING SERVER BENCHMARK");
+
+    const std::string socket_path = (std::filesystem::temp_directory_path()
+                                     / ("option_pricing_bench_" + std::to_string(BenchmarkConfig::RANDOM_SEED) + ".sock")).string();
+
+    Benchmark &benchmark = sharedHarness();
+    SamplingOptions single_run;
+    single_run.warmup_runs = 0;
+    single_run.min_samples = 1;
+    single_run.max_samples = 1;
+    single_run.min_time_ms = 0;
+
+    std::cout << std::left
+            << std::setw(12) << "Delay"
+            << std::setw(10) << "Clients"
+            << std::setw(14) << "Requests/s"
+            << std::setw(14) << "Opts/batch"
+            << std::setw(14) << "p50"
+            << std::setw(14) << "p99"
+            << "\n";
+    printTableSeparator();
+
+    double max_difference = 0.0;
+    bool rejected_invalid = false;
+
+    for (const double delay_us: BenchmarkConfig::SERVER_DELAYS_US) {
+        PricingServer server{PricingServerParameters{socket_path, delay_us}};
+        std::exception_ptr server_error;
+        std::thread serving{[&] {
+            try {
+                server.run();
+            } catch (...) {
+                server_error = std::current_exception();
+            }
+        }};
+        while (!server.listening() && !server_error) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        try {
+            if (server_error) std::rethrow_exception(server_error);
+
+            // Served prices must equal the in-process batch kernel on the same options
+            if (delay_us == BenchmarkConfig::SERVER_DELAYS_US.front()) {
+                const OptionBook book{64};
+                const OptionBatch batch = book.view();
+                std::vector<PricingProtocol::WireOption> options(batch.size);
+                for (std::size_t i = 0; i < batch.size; ++i) {
+                    options[i] = PricingProtocol::WireOption{
+                        batch.spot[i], batch.strike[i], batch.rate[i], batch.volatility[i], batch.expiry[i],
+                        batch.type[i] == Option::Type::CALL ? 0u : 1u, 0
+                    };
+                }
+                std::vector<double> prices(batch.size);
+                BlackScholesEngine{}.priceBatch(batch, BatchResults{prices.data()});
+
+                PricingClient client{socket_path};
+                const auto served = client.price(options, PricingProtocol::Method::BlackScholes);
+                for (std::size_t i = 0; i < batch.size; ++i) {
+                    max_difference = std::max(max_difference, std::abs(served[i].price - prices[i]));
+                }
+
+                options.front().volatility = -1.0;
+                try {
+                    static_cast<void>(client.price(options, PricingProtocol::Method::BlackScholes));
+                } catch (const std::invalid_argument &) {
+                    rejected_invalid = true;
+                }
+            }
+
+            for (const unsigned int connections: BenchmarkConfig::SERVER_CONNECTIONS) {
+                const LoadGenerator generator{LoadTestParameters{
+                    socket_path, connections, BenchmarkConfig::SERVER_REQUESTS / connections
+                }};
+                const PricingProtocol::WireStatistics before = server.statistics();
+                LoadTestReport report;
+                const std::string name = "Server_BS_Delay_" + std::to_string(static_cast<int>(delay_us))
+                                         + "us_Clients_" + std::to_string(connections);
+                benchmark.run(name, [&]() {
+                    report = generator.run();
+                    return report.p50_us;
+                }, 1, single_run);
+
+                const PricingProtocol::WireStatistics after = server.statistics();
+                const double batches = static_cast<double>(after.batches - before.batches);
+
+                std::cout << std::left
+                        << std::setw(12) << formatMicroseconds(delay_us)
+                        << std::setw(10) << connections
+                        << std::setw(14) << formatNumber(report.requestsPerSecond(), 0)
+                        << std::setw(14) << formatNumber(batches > 0 ? (after.options - before.options) / batches : 0.0, 1)
+                        << std::setw(14) << formatMicroseconds(report.p50_us)
+                        << std::setw(14) << formatMicroseconds(report.p99_us)
+                        << "\n";
+            }
+        } catch (...) {
+            server.stop();
+            serving.join();
+            throw;
+        }
+        server.stop();
+        serving.join();
+    }
+
+    std::cout << "\nRequests per run:     " << BenchmarkConfig::SERVER_REQUESTS << " (one option each, round trips)\n";
+    std::cout << "Max |served - in-process| price: " << formatNumber(max_difference, 2) << "\n";
+    std::cout << "Invalid option rejected: " << (rejected_invalid ? "yes" : "NO") << "\n";
+}
+
+/**
+ * Per-probe latency breakdown from the engines' instrumentation scopes
+ * - Only available when built with -DOPTION_PRICING_INSTRUMENTATION=ON
+ * - trace_path, if set, receives a Chrome trace of the profiled calls
+ */
+void runInstrumentationReport(const std::string &trace_path) {
+    printSectionHeader("INSTRUMENTATION (HOT-PATH PROFILE)");
+
+    if constexpr (!Instrumentation::compiled_in) {
+        std::cout << "Probes are compiled out; configure with -DOPTION_PRICING_INSTRUMENTATION=ON to profile.\n";
+        if (!trace_path.empty()) std::cout << "No trace written to " << trace_path << ".\n";
+        return;
+    }
+
+    const auto call = createTestOption();
+    const auto market = createTestMarket();
+
+    const BlackScholesEngine bs_engine;
+    SimulationParameters params{BenchmarkConfig::PROFILE_MC_PATHS, BenchmarkConfig::RANDOM_SEED};
+    const MonteCarloEngine mc_engine{params};
+    params.compute_greeks = false;
+    const MonteCarloEngine fd_engine{params};
+    const FiniteDifferenceGreeks fd_greeks{fd_engine, BenchmarkConfig::FD_EPSILON};
+
+    Instrumentation::reset();
+    if (!trace_path.empty()) Instrumentation::startTrace();
+
+    double checksum = 0;
+    for (int i = 0; i < BenchmarkConfig::PROFILE_BS_CALLS; ++i) {
+        checksum += bs_engine.price(call, market).price;
+    }
+    for (int i = 0; i < BenchmarkConfig::PROFILE_MC_CALLS; ++i) {
+        checksum += mc_engine.price(call, market).price;
+        checksum += fd_greeks.calculate(call, market).delta.value_or(0.0);
+    }
+
+    Instrumentation::stopTrace();
+
+    std::cout << std::left
+            << std::setw(16) << "Probe"
+            << std::setw(10) << "Calls"
+            << std::setw(12) << "Total"
+            << std::setw(12) << "Mean"
+            << std::setw(12) << "p50"
+            << std::setw(12) << "p99"
+            << std::setw(12) << "Max"
+            << "\n";
+    printTableSeparator();
+
+    for (const ProbeStatistics &probe: Instrumentation::statistics()) {
+        std::cout << std::left
+                << std::setw(16) << probeName(probe.probe)
+                << std::setw(10) << probe.count
+                << std::setw(12) << formatMicroseconds(probe.total_ns / 1000.0)
+                << std::setw(12) << formatMicroseconds(probe.mean_ns / 1000.0)
+                << std::setw(12) << formatMicroseconds(probe.p50_ns / 1000.0)
+                << std::setw(12) << formatMicroseconds(probe.p99_ns / 1000.0)
+                << std::setw(12) << formatMicroseconds(probe.max_ns / 1000.0)
+                << "\n";
+    }
+    std::cout << "\nChecksum: " << formatNumber(checksum, 4) << "\n";
+
+    if (!trace_path.empty()) {
+        std::ofstream trace{trace_path};
+        if (!trace) throw std::runtime_error("Cannot open " + trace_path);
+        const std::size_t events = Instrumentation::writeChromeTrace(trace);
+        std::cout << "Wrote " << events << " trace events to " << trace_path
+                << " (" << Instrumentation::droppedTraceEvents() << " dropped)\n";
+    }
+}
+
+/**
+ * Compares the medians of this run with a baseline written by --json
+ * - Lists every benchmark that moved by more than threshold_percent, either way
+ * - Returns the number of regressions (slower than baseline by more than the threshold)
+ */
+int compareWithBaseline(const std::string &baseline_path, const double threshold_percent) {
+    printSectionHeader("BASELINE COMPARISON");
+
+    std::ifstream in{baseline_path};
+    if (!in) throw std::runtime_error("Cannot open baseline " + baseline_path);
+
+    std::unordered_map<std::string, double> baseline_medians;
+    for (const BenchmarkResult &result: Benchmark::readJson(in)) {
+        baseline_medians[result.name] = result.statistics.median;
+    }
+
+    std::cout << "Baseline:  " << baseline_path << "\n";
+    std::cout << "Threshold: " << formatNumber(threshold_percent, 1) << "% on the median\n\n";
+
+    std::cout << std::left
+            << std::setw(32) << "Benchmark"
+            << std::setw(14) << "Baseline"
+            << std::setw(14) << "Current"
+            << std::setw(10) << "Change"
+            << std::setw(10) << "Status"
+            << "\n";
+    printTableSeparator();
+
+    int compared = 0;
+    int regressions = 0;
+    int improvements = 0;
+    int missing = 0;
+
+    for (const BenchmarkResult &result: sharedHarness().getResults()) {
+        const auto entry = baseline_medians.find(result.name);
+        if (entry == baseline_medians.end() || entry->second <= 0) {
+            ++missing;
+            continue;
+        }
+        ++compared;
+
+        const double change = 100.0 * (result.statistics.median / entry->second - 1.0);
+        if (std::abs(change) <= threshold_percent) continue;
+
+        const bool regression = change > 0;
+        if (regression) ++regressions; else ++improvements;
+
+        std::cout << std::left
+                << std::setw(32) << result.name
+                << std::setw(14) << formatMicroseconds(entry->second / 1000.0)
+                << std::setw(14) << formatMicroseconds(result.statistics.median / 1000.0)
+                << std::setw(10) << (change > 0 ? "+" : "") + formatNumber(change, 1) + "%"
+                << std::setw(10) << (regression ? "SLOWER" : "faster")
+                << "\n";
+    }
+
+    std::cout << "\n" << compared << " compared, " << regressions << " regression(s), "
+            << improvements << " improvement(s), " << missing << " not in baseline\n";
+    return regressions;
+}
+
+void printSummary() {
+    printSectionHeader("BENCHMARK SUMMARY");
+
+    std::cout << "Test Configuration:\n";
+    std::cout << "  Option Type:    European Call\n";
+    std::cout << std::setprecision(2);
+    std::cout << "  Spot Price:     $" << BenchmarkConfig::SPOT_PRICE << "\n";
+    std::cout << "  Strike Price:   $" << BenchmarkConfig::STRIKE_PRICE << "\n";
     std::cout << "  Risk-Free Rate: " << (BenchmarkConfig::RISK_FREE_RATE * 100) << "%\n";
     std::cout << "  Volatility:     " << (BenchmarkConfig::VOLATILITY * 100) << "%\n";
     std::cout << "  Time to Expiry: " << BenchmarkConfig::TIME_TO_EXPIRY << " year(s)\n";
     std::cout << "  Random Seed:    " << BenchmarkConfig::RANDOM_SEED << "\n";
 }
 
-int main() {
+int main(const int argc, char **argv) {
     try {
+        std::string json_path;
+        std::string baseline_path;
+        std::string trace_path;
+        double threshold_percent = BenchmarkConfig::REGRESSION_THRESHOLD_PERCENT;
+        std::vector<unsigned int> scaling_threads = defaultThreadCounts();
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg{argv[i]};
+            if (arg == "--json" && i + 1 < argc) {
+                json_path = argv[++i];
+            } else if (arg == "--trace" && i + 1 < argc) {
+                trace_path = argv[++i];
+            } else if (arg == "--baseline" && i + 1 < argc) {
+                baseline_path = argv[++i];
+            } else if (arg == "--threshold" && i + 1 < argc) {
+                threshold_percent = std::stod(argv[++i]);
+                if (!(threshold_percent >= 0)) throw std::invalid_argument("Threshold must be non-negative");
+            } else if (arg == "--threads" && i + 1 < argc) {
+                // comma-separated, e.g. 1,8,32 for the core counts used in production
+                scaling_threads.clear();
+                std::istringstream list{argv[++i]};
+                for (std::string item; std::getline(list, item, ',');) {
+                    const int threads = std::stoi(item);
+                    if (threads < 1) throw std::invalid_argument("Thread counts must be positive");
+                    scaling_threads.push_back(static_cast<unsigned int>(threads));
+                }
+                // speedups are relative to a measured single-thread run
+                scaling_threads.push_back(1);
+                std::sort(scaling_threads.begin(), scaling_threads.end());
+                scaling_threads.erase(std::unique(scaling_threads.begin(), scaling_threads.end()), scaling_threads.end());
+            } else {
+                std::cerr << "Usage: " << argv[0]
+                        << " [--json <path>] [--baseline <path>] [--threshold <percent>] [--threads <n,n,...>]"
+                        << " [--trace <path>]\n";
+                return 1;
+            }
+        }
+
         std::cout << std::fixed;
 
         std::cout << "\n";
@@ -383,8 +2666,37 @@ int main() {
         runConvergenceBenchmark();
         runPerformanceBenchmark();
         runGreeksBenchmark();
+        const int cdf_violations = runNormalCdfBenchmark();
+        runKernelBenchmark();
+        runPrecisionBenchmark();
+        runImpliedVolatilityBenchmark();
+        runPathDependentBenchmark();
+        runLatticeBenchmark();
+        runPdeBenchmark();
+        runScenarioGridBenchmark();
+        runScalingBenchmark(scaling_threads);
+        runColumnarBenchmark();
+        runServerBenchmark();
+        runInstrumentationReport(trace_path);
 
         printSummary();
+
+        if (!json_path.empty()) {
+            std::ofstream json{json_path};
+            if (!json) throw std::runtime_error("Cannot open " + json_path);
+            sharedHarness().writeJson(json);
+            std::cout << "\nWrote " << sharedHarness().getResults().size() << " results to " << json_path << "\n";
+        }
+
+        if (cdf_violations > 0) {
+            std::cerr << "\nError: " << cdf_violations << " CDF tier(s) exceeded their stated error bound\n";
+            return 1;
+        }
+
+        // A distinct exit code lets CI tell regressions from failures
+        if (!baseline_path.empty() && compareWithBaseline(baseline_path, threshold_percent) > 0) {
+            return 2;
+        }
     } catch (const std::exception &e) {
         std::cerr << "\nError: " << e.what() << "\n";
         return 1;
@@ -1,54 +1,177 @@
 #include "black_scholes.h"
 #include "financial_math.h"
+#include "instrumentation.h"
+#include "pricing_kernels.h"
 #include <cmath>
+#include <stdexcept>
 
+namespace {
+    using PricingKernels::TypeMix;
+    using PricingKernels::wants;
 
-Greeks BlackScholesEngine::calculateAnalyticalGreeks(
-    const Option &option,
-    const MarketParameters &market_parameters,
-    const double d1,
-    const double d2
-) {
-    Greeks greeks;
+    template<typename Vec>
+    struct VectorGreeks {
+        Vec price;
+        Vec delta;
+        Vec gamma;
+        Vec vega;
+        Vec theta;
+        Vec rho;
+    };
 
-    const double spot = market_parameters.spot_price;
-    const double strike = option.getStrike();
-    const double rate = market_parameters.risk_free_rate;
-    const double vol = market_parameters.volatility;
-    const double expiry = option.getExpiry();
+    // omega * x, a no-op for an all-call book and a negation for an all-put book
+    template<TypeMix Mix, typename Vec>
+    Vec withSign(const Vec omega, const Vec x) {
+        if constexpr (Mix == TypeMix::Calls) {
+            return x;
+        } else if constexpr (Mix == TypeMix::Puts) {
+            return -x;
+        } else {
+            return omega * x;
+        }
+    }
+
+    /**
+     * Branch-free Black-Scholes for one vector of options, Vec = DoubleVec or FloatVec
+     * - omega = +1 for calls, -1 for puts: price = omega * (S N(omega d1) - K e^{-rT} N(omega d2))
+     * - omega is only read for mixed books
+     */
+    template<typename Vec, CdfAccuracy Accuracy, TypeMix Mix>
+    VectorGreeks<Vec> priceVector(
+        const Vec spot,
+        const Vec strike,
+        const Vec rate,
+        const Vec vol,
+        const Vec expiry,
+        const Vec omega
+    ) {
+        const Vec sqrt_expiry = Simd::sqrt(expiry);
+        const Vec vol_sqrt_expiry = vol * sqrt_expiry;
+        const Vec discounted_strike = strike * Simd::exp(-rate * expiry);
+
+        const Vec d1 = Simd::fma(Simd::fma(0.5 * vol, vol, rate), expiry, Simd::log(spot / strike)) / vol_sqrt_expiry;
+        const Vec d2 = d1 - vol_sqrt_expiry;
+
+        const Vec cdf_d1 = FinancialMath::normalCDF<Accuracy>(withSign<Mix>(omega, d1));
+        const Vec cdf_d2 = FinancialMath::normalCDF<Accuracy>(withSign<Mix>(omega, d2));
+        const Vec phi_d1 = FinancialMath::normalPDF<Accuracy>(d1);
+
+        VectorGreeks<Vec> out;
+        out.price = withSign<Mix>(omega, spot * cdf_d1 - discounted_strike * cdf_d2);
+        out.delta = withSign<Mix>(omega, cdf_d1);
+        out.gamma = phi_d1 / (spot * vol_sqrt_expiry);
+        out.vega = spot * phi_d1 * sqrt_expiry / 100.0;
 
-    if (option.getType() == Option::Type::CALL) {
-        greeks.delta = FinancialMath::normalCDF(d1);
-    } else {
-        greeks.delta = FinancialMath::normalCDF(d1) - 1.0;
+        // Theta time unit = days
+        const Vec term1 = -(spot * phi_d1 * vol) / (2.0 * sqrt_expiry);
+        out.theta = (term1 - withSign<Mix>(omega, rate) * discounted_strike * cdf_d2) / 365.0;
+        out.rho = withSign<Mix>(omega, discounted_strike) * expiry * cdf_d2 / 100.0;
+        return out;
     }
 
-    const double phi_d1 = FinancialMath::normalPDF(d1);
-    greeks.gamma = phi_d1 / (spot * vol * std::sqrt(expiry));
+    // Greek set of a batch whose non-null outputs are not one of the dedicated sets: all Greeks
+    // are computed and each store checks its pointer
+    constexpr unsigned requested_greeks = 1u << 8;
 
-    // Divided by 100 for per 1% change
-    greeks.vega = spot * phi_d1 * std::sqrt(expiry) / 100.0;
+    template<unsigned Greeks>
+    constexpr bool stores(const Greek greek) {
+        return Greeks == requested_greeks || wants<Greeks>(greek);
+    }
+
+    template<typename Vec, TypeMix Mix>
+    Vec omegas(const OptionBatch &batch, const std::size_t offset, const std::size_t count) {
+        if constexpr (Mix != TypeMix::Mixed) {
+            return Vec(0.0);
+        } else {
+            double omega[Vec::width];
+            for (std::size_t lane = 0; lane < Vec::width; ++lane) {
+                omega[lane] = (lane < count && batch.type[offset + lane] == Option::Type::PUT) ? -1.0 : 1.0;
+            }
+            return Vec::load(omega);
+        }
+    }
 
-    const double term1 = -(spot * phi_d1 * vol) / (2.0 * std::sqrt(expiry));
+    template<unsigned Greeks, typename Vec>
+    void store(const Vec value, double *out, const Greek greek, const std::size_t offset, const std::size_t count) {
+        if constexpr (Greeks == requested_greeks) {
+            if (out) Simd::storePartial(value, out + offset, count);
+        } else {
+            if (wants<Greeks>(greek)) Simd::storePartial(value, out + offset, count);
+        }
+    }
+
+    // Prices batch[offset, offset + count), count <= lanes; a partial tail is padded with a benign option.
+    // Greeks that are not stored are dead code after inlining, so the compiler drops them
+    template<typename Vec, CdfAccuracy Accuracy, TypeMix Mix, unsigned Greeks>
+    void priceChunk(const OptionBatch &batch, const BatchResults &results, const std::size_t offset, const std::size_t count) {
+        const VectorGreeks<Vec> out = priceVector<Vec, Accuracy, Mix>(
+            Simd::loadPartial<Vec>(batch.spot + offset, count, 1.0),
+            Simd::loadPartial<Vec>(batch.strike + offset, count, 1.0),
+            Simd::loadPartial<Vec>(batch.rate + offset, count, 0.0),
+            Simd::loadPartial<Vec>(batch.volatility + offset, count, 1.0),
+            Simd::loadPartial<Vec>(batch.expiry + offset, count, 1.0),
+            omegas<Vec, Mix>(batch, offset, count)
+        );
 
-    // Theta time unit = days
-    if (option.getType() == Option::Type::CALL) {
-        const double term2 = rate * strike * std::exp(-rate * expiry) * FinancialMath::normalCDF(d2);
-        greeks.theta = (term1 - term2) / 365.0;
-    } else {
-        const double term2 = rate * strike * std::exp(-rate * expiry) * FinancialMath::normalCDF(-d2);
-        greeks.theta = (term1 + term2) / 365.0;
+        Simd::storePartial(out.price, results.price + offset, count);
+        if constexpr (stores<Greeks>(Greek::Delta)) store<Greeks>(out.delta, results.delta, Greek::Delta, offset, count);
+        if constexpr (stores<Greeks>(Greek::Gamma)) store<Greeks>(out.gamma, results.gamma, Greek::Gamma, offset, count);
+        if constexpr (stores<Greeks>(Greek::Vega)) store<Greeks>(out.vega, results.vega, Greek::Vega, offset, count);
+        if constexpr (stores<Greeks>(Greek::Theta)) store<Greeks>(out.theta, results.theta, Greek::Theta, offset, count);
+        if constexpr (stores<Greeks>(Greek::Rho)) store<Greeks>(out.rho, results.rho, Greek::Rho, offset, count);
     }
 
-    const double discount_factor = strike * expiry * std::exp(-rate * expiry) / 100.0;
+    template<typename Vec, CdfAccuracy Accuracy, TypeMix Mix, unsigned Greeks>
+    void priceAll(const OptionBatch &batch, const BatchResults &results) {
+        constexpr std::size_t lanes = Vec::width;
+        std::size_t offset = 0;
+        for (; offset + lanes <= batch.size; offset += lanes) {
+            priceChunk<Vec, Accuracy, Mix, Greeks>(batch, results, offset, lanes);
+        }
+
+        if (offset < batch.size) {
+            priceChunk<Vec, Accuracy, Mix, Greeks>(batch, results, offset, batch.size - offset);
+        }
+    }
 
-    if (option.getType() == Option::Type::CALL) {
-        greeks.rho = discount_factor * FinancialMath::normalCDF(d2);
-    } else {
-        greeks.rho = -discount_factor * FinancialMath::normalCDF(-d2);
+    // Scalar kernel with every Greek; the type branch is taken once, outside the kernel
+    template<CdfAccuracy Accuracy>
+    void evaluateAs(
+        const Option::Type type,
+        const double spot,
+        const double d1,
+        const double vol_sqrt_expiry,
+        const double sqrt_expiry,
+        const double discounted_strike,
+        const double theta_decay,
+        const double rate,
+        const double expiry,
+        CompactPricingResult &out
+    ) {
+        if (type == Option::Type::CALL) {
+            PricingKernels::blackScholes<Option::Type::CALL, PricingKernels::ALL_GREEKS, Accuracy>(
+                spot, d1, vol_sqrt_expiry, sqrt_expiry, discounted_strike, theta_decay, rate, expiry, out);
+        } else {
+            PricingKernels::blackScholes<Option::Type::PUT, PricingKernels::ALL_GREEKS, Accuracy>(
+                spot, d1, vol_sqrt_expiry, sqrt_expiry, discounted_strike, theta_decay, rate, expiry, out);
+        }
     }
 
-    return greeks;
+    // Greek set of the non-null outputs
+    template<typename Kernel>
+    decltype(auto) withGreeks(const BatchResults &results, Kernel &&kernel) {
+        const unsigned mask = (results.delta ? 1u << static_cast<unsigned>(Greek::Delta) : 0u)
+                              | (results.gamma ? 1u << static_cast<unsigned>(Greek::Gamma) : 0u)
+                              | (results.vega ? 1u << static_cast<unsigned>(Greek::Vega) : 0u)
+                              | (results.theta ? 1u << static_cast<unsigned>(Greek::Theta) : 0u)
+                              | (results.rho ? 1u << static_cast<unsigned>(Greek::Rho) : 0u);
+        switch (mask) {
+            case PricingKernels::NO_GREEKS: return kernel(std::integral_constant<unsigned, PricingKernels::NO_GREEKS>{});
+            case PricingKernels::DELTA_ONLY: return kernel(std::integral_constant<unsigned, PricingKernels::DELTA_ONLY>{});
+            case PricingKernels::ALL_GREEKS: return kernel(std::integral_constant<unsigned, PricingKernels::ALL_GREEKS>{});
+            default: return kernel(std::integral_constant<unsigned, requested_greeks>{});
+        }
+    }
 }
 
 
@@ -56,25 +179,109 @@ PricingResult BlackScholesEngine::price(
     const Option &option,
     const MarketParameters &market_parameters
 ) const {
+    PRICING_SCOPE(Probe::BlackScholesPrice);
+
     const double spot = market_parameters.spot_price;
     const double rate = market_parameters.risk_free_rate;
     const double vol = market_parameters.volatility;
-    const double strike = option.getStrike();
     const double expiry = option.getExpiry();
 
-    const double d1 = FinancialMath::calculateD1(spot, strike, rate, vol, expiry);
-    const double d2 = FinancialMath::calculateD2(d1, vol, expiry);
+    const double sqrt_expiry = std::sqrt(expiry);
+    const double vol_sqrt_expiry = vol * sqrt_expiry;
+    const double d1 = (std::log(spot / option.getStrike()) + (rate + 0.5 * vol * vol) * expiry) / vol_sqrt_expiry;
+
+    CompactPricingResult out;
+    evaluate(option.getType(), spot, d1, vol_sqrt_expiry, sqrt_expiry, option.getStrike() * std::exp(-rate * expiry),
+             vol / (2.0 * sqrt_expiry), rate, expiry, out);
+    return out.toPricingResult();
+}
 
-    double option_price;
-    if (option.getType() == Option::Type::CALL) {
-        option_price = spot * FinancialMath::normalCDF(d1) - strike * std::exp(-rate * expiry) * FinancialMath::normalCDF(d2);
-    } else {
-        option_price = strike * std::exp(-rate * expiry) * FinancialMath::normalCDF(-d2) - spot * FinancialMath::normalCDF(-d1);
+void BlackScholesEngine::evaluate(
+    const Option::Type type,
+    const double spot,
+    const double d1,
+    const double vol_sqrt_expiry,
+    const double sqrt_expiry,
+    const double discounted_strike,
+    const double theta_decay,
+    const double rate,
+    const double expiry,
+    CompactPricingResult &out
+) const {
+    switch (cdf_accuracy_) {
+        case CdfAccuracy::High:
+            evaluateAs<CdfAccuracy::High>(type, spot, d1, vol_sqrt_expiry, sqrt_expiry, discounted_strike, theta_decay,
+                                          rate, expiry, out);
+            break;
+        case CdfAccuracy::Fast:
+            evaluateAs<CdfAccuracy::Fast>(type, spot, d1, vol_sqrt_expiry, sqrt_expiry, discounted_strike, theta_decay,
+                                          rate, expiry, out);
+            break;
+        default:
+            evaluateAs<CdfAccuracy::Full>(type, spot, d1, vol_sqrt_expiry, sqrt_expiry, discounted_strike, theta_decay,
+                                          rate, expiry, out);
+            break;
     }
+}
+
+void BlackScholesEngine::priceInto(
+    const Option &option,
+    const MarketParameters &market_parameters,
+    CompactPricingResult &out
+) const {
+    PRICING_SCOPE(Probe::BlackScholesCompact);
+
+    const double spot = market_parameters.spot_price;
+    const double rate = market_parameters.risk_free_rate;
+    const double vol = market_parameters.volatility;
+    const double strike = option.getStrike();
+    const double expiry = option.getExpiry();
+
+    const double sqrt_expiry = std::sqrt(expiry);
+    const double vol_sqrt_expiry = vol * sqrt_expiry;
+    const double d1 = (std::log(spot / strike) + (rate + 0.5 * vol * vol) * expiry) / vol_sqrt_expiry;
+
+    evaluate(option.getType(), spot, d1, vol_sqrt_expiry, sqrt_expiry, strike * std::exp(-rate * expiry),
+             vol / (2.0 * sqrt_expiry), rate, expiry, out);
+}
+
+void BlackScholesEngine::priceInto(const PreparedOption &prepared, const double spot, CompactPricingResult &out) const {
+    if (spot <= 0) throw std::invalid_argument("Spot price must be positive");
+
+    const double d1 = (std::log(spot) - prepared.logStrike() + prepared.drift()) * prepared.invVolSqrtExpiry();
+    evaluate(prepared.getOption().getType(), spot, d1, prepared.volSqrtExpiry(), prepared.sqrtExpiry(), prepared.discountedStrike(),
+             prepared.thetaDecay(), prepared.getRate(), prepared.getOption().getExpiry(), out);
+}
+
+PricingResult BlackScholesEngine::price(const PreparedOption &prepared, const double spot) const {
+    CompactPricingResult out;
+    priceInto(prepared, spot, out);
+    return out.toPricingResult();
+}
 
-    const Greeks greeks = calculateAnalyticalGreeks(option, market_parameters, d1, d2);
+PricingResult BlackScholesEngine::price(PreparedOption &prepared, const MarketParameters &market_parameters) const {
+    prepared.bind(market_parameters.risk_free_rate, market_parameters.volatility);
+    return price(prepared, market_parameters.spot_price);
+}
+
+void BlackScholesEngine::priceBatch(
+    const OptionBatch &batch,
+    const BatchResults &results,
+    const Precision precision
+) const {
+    PRICING_SCOPE(Probe::BlackScholesBatch);
 
-    return PricingResult{option_price, greeks, "Black-Scholes"};
+    // One instantiation per batch: precision, accuracy tier, call/put/mixed book and requested Greeks
+    PricingKernels::withPrecision(precision, [&](auto real) {
+        using Vec = Simd::VectorOf<PricingKernels::Real<real()>>;
+        PricingKernels::withAccuracy(cdf_accuracy_, [&](auto accuracy) {
+            PricingKernels::withTypeMix(PricingKernels::typeMix(batch.type, batch.size), [&](auto mix) {
+                withGreeks(results, [&](auto greeks) {
+                    priceAll<Vec, accuracy(), mix(), greeks()>(batch, results);
+                });
+            });
+        });
+    });
 }
 
 std::string BlackScholesEngine::getName() const {
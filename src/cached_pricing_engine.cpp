@@ -0,0 +1,158 @@
+#include "cached_pricing_engine.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+    // splitmix64 finalizer
+    std::uint64_t mix(std::uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    std::uint64_t bits(const double value) {
+        std::uint64_t result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+}
+
+std::size_t CachedPricingEngine::KeyHash::operator()(const Key &key) const {
+    std::uint64_t hash = mix(bits(key.strike));
+    hash = mix(hash ^ bits(key.expiry));
+    hash = mix(hash ^ bits(key.spot));
+    hash = mix(hash ^ bits(key.rate));
+    hash = mix(hash ^ bits(key.volatility));
+    hash = mix(hash ^ static_cast<std::uint64_t>(key.type));
+    return static_cast<std::size_t>(hash);
+}
+
+CachedPricingEngine::CachedPricingEngine(const PricingEngine &engine, const CacheParameters &parameters)
+    : engine_{engine},
+      parameters_{parameters},
+      shard_capacity_{(parameters.capacity + parameters.num_shards - 1) / parameters.num_shards},
+      shards_(parameters.num_shards) {
+    parameters_.validate();
+    for (Shard &shard: shards_) {
+        shard.index.reserve(shard_capacity_);
+        shard.slots.reserve(shard_capacity_);
+    }
+}
+
+std::optional<CachedPricingEngine::Key> CachedPricingEngine::makeKey(
+    const Option &option,
+    const MarketParameters &market_parameters
+) const {
+    const double inv_tolerance = 1.0 / parameters_.tolerance;
+
+    // + 0.0 folds -0.0 into 0.0, which compares equal but hashes differently
+    const auto quantize = [&](const double value) { return std::round(value * inv_tolerance) + 0.0; };
+
+    const Key key{
+        quantize(option.getStrike()),
+        quantize(option.getExpiry()),
+        quantize(market_parameters.spot_price),
+        quantize(market_parameters.risk_free_rate),
+        quantize(market_parameters.volatility),
+        option.getType()
+    };
+    for (const double index: {key.strike, key.expiry, key.spot, key.rate, key.volatility}) {
+        if (!std::isfinite(index)) return std::nullopt;
+    }
+    return key;
+}
+
+PricingResult CachedPricingEngine::price(const Option &option, const MarketParameters &market_parameters) const {
+    market_parameters.validate();
+
+    // High hash bits pick the shard, the map uses the low ones
+    const std::optional<Key> quantized = makeKey(option, market_parameters);
+    if (!quantized) return engine_.price(option, market_parameters);
+
+    const Key &key = *quantized;
+    Shard &shard = shards_[(static_cast<std::uint64_t>(KeyHash{}(key)) >> 32) % shards_.size()];
+
+    {
+        std::lock_guard lock{shard.mutex};
+        const auto found = shard.index.find(key);
+        if (found != shard.index.end()) {
+            Entry &entry = shard.slots[found->second];
+            entry.referenced = true;
+            ++shard.hits;
+            return entry.result;
+        }
+        ++shard.misses;
+    }
+
+    // Concurrent misses on one key both price it, the later insert wins
+    const PricingResult result = engine_.price(option, market_parameters);
+
+    std::lock_guard lock{shard.mutex};
+    insert(shard, key, result);
+    return result;
+}
+
+void CachedPricingEngine::insert(Shard &shard, const Key &key, const PricingResult &result) const {
+    const auto found = shard.index.find(key);
+    if (found != shard.index.end()) {
+        shard.slots[found->second].result = result;
+        return;
+    }
+
+    if (shard.slots.size() < shard_capacity_) {
+        shard.index.emplace(key, shard.slots.size());
+        shard.slots.push_back(Entry{key, result, false});
+        return;
+    }
+
+    // CLOCK: give referenced entries a second chance, evict the first unreferenced one
+    while (shard.slots[shard.hand].referenced) {
+        shard.slots[shard.hand].referenced = false;
+        shard.hand = (shard.hand + 1) % shard.slots.size();
+    }
+
+    Entry &victim = shard.slots[shard.hand];
+    shard.index.erase(victim.key);
+    shard.index.emplace(key, shard.hand);
+    victim = Entry{key, result, false};
+    shard.hand = (shard.hand + 1) % shard.slots.size();
+    ++shard.evictions;
+}
+
+std::vector<double> CachedPricingEngine::priceScenarios(
+    const Option &option,
+    const MarketParameters &market_parameters,
+    const std::vector<BumpScenario> &scenarios
+) const {
+    return engine_.priceScenarios(option, market_parameters, scenarios);
+}
+
+std::string CachedPricingEngine::getName() const {
+    return "Cached " + engine_.getName();
+}
+
+CacheStatistics CachedPricingEngine::statistics() const {
+    CacheStatistics stats;
+    for (Shard &shard: shards_) {
+        std::lock_guard lock{shard.mutex};
+        stats.hits += shard.hits;
+        stats.misses += shard.misses;
+        stats.evictions += shard.evictions;
+        stats.size += shard.slots.size();
+    }
+    return stats;
+}
+
+void CachedPricingEngine::clear() {
+    for (Shard &shard: shards_) {
+        std::lock_guard lock{shard.mutex};
+        shard.index.clear();
+        shard.slots.clear();
+        shard.hand = 0;
+        shard.hits = 0;
+        shard.misses = 0;
+        shard.evictions = 0;
+    }
+}
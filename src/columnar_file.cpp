@@ -0,0 +1,356 @@
+#include "columnar_file.h"
+#include "csv_book.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    constexpr char magic[8] = {'O', 'P', 'T', 'C', 'O', 'L', 'S', '1'};
+    constexpr std::uint32_t byte_order_mark = 0x01020304;
+    constexpr std::size_t column_alignment = 64;
+
+    static_assert(sizeof(Option::Type) == sizeof(std::int32_t), "type column stores Option::Type as 32 bits");
+
+    struct Header {
+        char magic[8];
+        std::uint32_t byte_order;
+        std::uint32_t version;
+        std::uint32_t kind;
+        std::uint32_t column_count;
+        std::uint64_t rows;
+        std::uint64_t capacity;
+        unsigned char reserved[24];
+    };
+    static_assert(sizeof(Header) == 64, "header is one cache line");
+
+    struct ColumnDescriptor {
+        std::uint32_t id;
+        std::uint32_t element_size;
+        std::uint64_t offset;
+    };
+    static_assert(sizeof(ColumnDescriptor) == 16, "directory entries are packed");
+
+    struct ColumnSpec {
+        ColumnId id;
+        std::uint32_t element_size;
+    };
+
+    constexpr ColumnSpec book_columns[] = {
+        {ColumnId::Strike, 8}, {ColumnId::Expiry, 8}, {ColumnId::Type, 4},
+        {ColumnId::Spot, 8}, {ColumnId::Rate, 8}, {ColumnId::Volatility, 8}
+    };
+    constexpr ColumnSpec result_columns[] = {
+        {ColumnId::Price, 8}, {ColumnId::StandardError, 8}, {ColumnId::Delta, 8}, {ColumnId::Gamma, 8},
+        {ColumnId::Vega, 8}, {ColumnId::Theta, 8}, {ColumnId::Rho, 8}
+    };
+    constexpr std::size_t max_columns = 7;
+
+    struct ColumnLayout {
+        const ColumnSpec *columns;
+        std::size_t count;
+    };
+
+    ColumnLayout layoutOf(const ColumnarKind kind) {
+        switch (kind) {
+            case ColumnarKind::Book: return {book_columns, std::size(book_columns)};
+            case ColumnarKind::Results: return {result_columns, std::size(result_columns)};
+            default: throw std::invalid_argument("Unknown columnar file kind");
+        }
+    }
+
+    std::size_t alignUp(const std::size_t value) {
+        return (value + column_alignment - 1) / column_alignment * column_alignment;
+    }
+
+    [[noreturn]] void throwSystemError(const std::string &what, const std::string &path) {
+        throw std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+    }
+
+    // A view's column; null only when the directory lacks it, which open() and create() rule out
+    template<typename T, typename Pointer>
+    T *requireColumn(Pointer column) {
+        if (!column) throw std::invalid_argument("Corrupt columnar directory: missing column");
+        return static_cast<T *>(column);
+    }
+
+    // Closes the descriptor on every path; the mapping stays valid after close
+    struct FileDescriptor {
+        int fd;
+        ~FileDescriptor() { if (fd >= 0) ::close(fd); }
+    };
+
+    // Upper bound on data rows: every line, counted without parsing
+    std::uint64_t countLines(std::FILE *file) {
+        std::vector<char> buffer(1 << 20);
+        std::uint64_t lines = 0;
+        char last = '\n';
+
+        std::size_t read;
+        while ((read = std::fread(buffer.data(), 1, buffer.size(), file)) > 0) {
+            lines += static_cast<std::uint64_t>(std::count(buffer.data(), buffer.data() + read, '\n'));
+            last = buffer[read - 1];
+        }
+        if (std::ferror(file)) throw std::runtime_error("Failed reading book input");
+        return lines + (last != '\n' ? 1 : 0);
+    }
+}
+
+ColumnarFile::ColumnarFile(unsigned char *data, const std::size_t bytes, const bool writable)
+    : data_{data}, bytes_{bytes}, writable_{writable} {}
+
+ColumnarFile::~ColumnarFile() {
+    release();
+}
+
+ColumnarFile::ColumnarFile(ColumnarFile &&other) noexcept
+    : data_{other.data_}, bytes_{other.bytes_}, writable_{other.writable_} {
+    other.data_ = nullptr;
+    other.bytes_ = 0;
+}
+
+ColumnarFile &ColumnarFile::operator=(ColumnarFile &&other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        bytes_ = other.bytes_;
+        writable_ = other.writable_;
+        other.data_ = nullptr;
+        other.bytes_ = 0;
+    }
+    return *this;
+}
+
+void ColumnarFile::release() {
+    if (data_) ::munmap(data_, bytes_);
+    data_ = nullptr;
+    bytes_ = 0;
+}
+
+ColumnarFile ColumnarFile::open(const std::string &path) {
+    const FileDescriptor file{::open(path.c_str(), O_RDONLY)};
+    if (file.fd < 0) throwSystemError("Cannot open", path);
+
+    struct stat status{};
+    if (::fstat(file.fd, &status) != 0) throwSystemError("Cannot stat", path);
+    const auto bytes = static_cast<std::size_t>(status.st_size);
+    if (bytes < sizeof(Header)) throw std::invalid_argument("Not a columnar file: " + path);
+
+    void *mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, file.fd, 0);
+    if (mapping == MAP_FAILED) throwSystemError("Cannot map", path);
+    ::madvise(mapping, bytes, MADV_SEQUENTIAL);
+    ColumnarFile mapped{static_cast<unsigned char *>(mapping), bytes, false};
+
+    Header header{};
+    std::memcpy(&header, mapped.data_, sizeof(header));
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+        throw std::invalid_argument("Not a columnar file: " + path);
+    }
+    if (header.byte_order != byte_order_mark) {
+        throw std::invalid_argument("Columnar file has the wrong byte order: " + path);
+    }
+    if (header.version != VERSION) throw std::invalid_argument("Unsupported columnar file version: " + path);
+    if (header.rows > header.capacity) throw std::invalid_argument("Corrupt columnar header: " + path);
+
+    const ColumnLayout expected = layoutOf(static_cast<ColumnarKind>(header.kind));
+    if (header.column_count != expected.count
+        || sizeof(Header) + expected.count * sizeof(ColumnDescriptor) > bytes) {
+        throw std::invalid_argument("Corrupt columnar directory: " + path);
+    }
+
+    // Every column of the layout exactly once, as a bit per column id
+    std::uint32_t required = 0;
+    for (std::size_t c = 0; c < expected.count; ++c) {
+        required |= std::uint32_t{1} << static_cast<std::uint32_t>(expected.columns[c].id);
+    }
+
+    std::uint32_t seen = 0;
+    for (std::size_t c = 0; c < expected.count; ++c) {
+        ColumnDescriptor column{};
+        std::memcpy(&column, mapped.data_ + sizeof(Header) + c * sizeof(column), sizeof(column));
+
+        const bool known = std::any_of(expected.columns, expected.columns + expected.count, [&](const ColumnSpec &spec) {
+            return static_cast<std::uint32_t>(spec.id) == column.id && spec.element_size == column.element_size;
+        });
+        const bool in_bounds = known
+                               && column.offset % column_alignment == 0
+                               && column.offset >= sizeof(Header)
+                               && column.offset <= bytes
+                               && header.capacity <= (bytes - column.offset) / column.element_size;
+        const std::uint32_t bit = known ? std::uint32_t{1} << column.id : 0;
+        if (!known || !in_bounds || (seen & bit)) throw std::invalid_argument("Corrupt columnar directory: " + path);
+        seen |= bit;
+    }
+    if (seen != required) throw std::invalid_argument("Corrupt columnar directory: " + path);
+    return mapped;
+}
+
+ColumnarFile ColumnarFile::create(const std::string &path, const ColumnarKind kind, const std::uint64_t capacity) {
+    const ColumnLayout layout = layoutOf(kind);
+
+    std::size_t bytes = alignUp(sizeof(Header) + layout.count * sizeof(ColumnDescriptor));
+    ColumnDescriptor directory[max_columns];
+    for (std::size_t c = 0; c < layout.count; ++c) {
+        const ColumnSpec &spec = layout.columns[c];
+        directory[c] = ColumnDescriptor{static_cast<std::uint32_t>(spec.id), spec.element_size, bytes};
+        bytes = alignUp(bytes + capacity * spec.element_size);
+    }
+
+    const FileDescriptor file{::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)};
+    if (file.fd < 0) throwSystemError("Cannot create", path);
+    if (::ftruncate(file.fd, static_cast<off_t>(bytes)) != 0) throwSystemError("Cannot size", path);
+
+    void *mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file.fd, 0);
+    if (mapping == MAP_FAILED) throwSystemError("Cannot map", path);
+    ColumnarFile mapped{static_cast<unsigned char *>(mapping), bytes, true};
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.byte_order = byte_order_mark;
+    header.version = VERSION;
+    header.kind = static_cast<std::uint32_t>(kind);
+    header.column_count = static_cast<std::uint32_t>(layout.count);
+    header.rows = capacity;
+    header.capacity = capacity;
+    std::memcpy(mapped.data_, &header, sizeof(header));
+    std::memcpy(mapped.data_ + sizeof(Header), directory, layout.count * sizeof(ColumnDescriptor));
+    return mapped;
+}
+
+ColumnarFile ColumnarFile::writeBook(const std::string &path, const OptionBatch &batch) {
+    ColumnarFile book = create(path, ColumnarKind::Book, batch.size);
+    const auto copy = [&](const ColumnId id, const void *source, const std::size_t element_size) {
+        if (batch.size > 0) std::memcpy(book.mutableColumn(id), source, batch.size * element_size);
+    };
+
+    copy(ColumnId::Strike, batch.strike, sizeof(double));
+    copy(ColumnId::Expiry, batch.expiry, sizeof(double));
+    copy(ColumnId::Type, batch.type, sizeof(Option::Type));
+    copy(ColumnId::Spot, batch.spot, sizeof(double));
+    copy(ColumnId::Rate, batch.rate, sizeof(double));
+    copy(ColumnId::Volatility, batch.volatility, sizeof(double));
+    return book;
+}
+
+ColumnarFile ColumnarFile::convertCsv(const std::string &csv_path, const std::string &book_path) {
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> csv{std::fopen(csv_path.c_str(), "rb"), &std::fclose};
+    if (!csv) throwSystemError("Cannot open", csv_path);
+
+    const std::uint64_t capacity = countLines(csv.get());
+    std::rewind(csv.get());
+
+    ColumnarFile book = create(book_path, ColumnarKind::Book, capacity);
+    auto *strike = static_cast<double *>(book.mutableColumn(ColumnId::Strike));
+    auto *expiry = static_cast<double *>(book.mutableColumn(ColumnId::Expiry));
+    auto *type = static_cast<Option::Type *>(book.mutableColumn(ColumnId::Type));
+    auto *spot = static_cast<double *>(book.mutableColumn(ColumnId::Spot));
+    auto *rate = static_cast<double *>(book.mutableColumn(ColumnId::Rate));
+    auto *volatility = static_cast<double *>(book.mutableColumn(ColumnId::Volatility));
+
+    CsvBookReader reader{csv.get()};
+    CsvOptionRow row{};
+    std::size_t rows = 0;
+    while (reader.next(row)) {
+        strike[rows] = row.strike;
+        expiry[rows] = row.expiry;
+        type[rows] = row.type;
+        spot[rows] = row.spot;
+        rate[rows] = row.rate;
+        volatility[rows] = row.volatility;
+        ++rows;
+    }
+
+    book.resize(rows);
+    return book;
+}
+
+ColumnarKind ColumnarFile::kind() const {
+    std::uint32_t kind = 0;
+    if (data_) std::memcpy(&kind, data_ + offsetof(Header, kind), sizeof(kind));
+    return static_cast<ColumnarKind>(kind);
+}
+
+std::size_t ColumnarFile::size() const {
+    std::uint64_t rows = 0;
+    if (data_) std::memcpy(&rows, data_ + offsetof(Header, rows), sizeof(rows));
+    return static_cast<std::size_t>(rows);
+}
+
+std::size_t ColumnarFile::capacity() const {
+    std::uint64_t capacity = 0;
+    if (data_) std::memcpy(&capacity, data_ + offsetof(Header, capacity), sizeof(capacity));
+    return static_cast<std::size_t>(capacity);
+}
+
+void ColumnarFile::resize(const std::size_t rows) {
+    if (!writable_) throw std::logic_error("Columnar file is read-only");
+    if (rows > capacity()) throw std::invalid_argument("Row count exceeds the file's capacity");
+
+    const auto value = static_cast<std::uint64_t>(rows);
+    std::memcpy(data_ + offsetof(Header, rows), &value, sizeof(value));
+}
+
+std::size_t ColumnarFile::columnOffset(const ColumnId id) const {
+    if (!data_) return 0;
+
+    std::uint32_t column_count = 0;
+    std::memcpy(&column_count, data_ + offsetof(Header, column_count), sizeof(column_count));
+    for (std::size_t c = 0; c < column_count; ++c) {
+        ColumnDescriptor column{};
+        std::memcpy(&column, data_ + sizeof(Header) + c * sizeof(column), sizeof(column));
+        if (column.id == static_cast<std::uint32_t>(id)) return static_cast<std::size_t>(column.offset);
+    }
+    return 0;
+}
+
+const void *ColumnarFile::column(const ColumnId id) const {
+    const std::size_t offset = columnOffset(id);
+    return offset ? data_ + offset : nullptr;
+}
+
+void *ColumnarFile::mutableColumn(const ColumnId id) {
+    if (!writable_) throw std::logic_error("Columnar file is read-only");
+    const std::size_t offset = columnOffset(id);
+    return offset ? data_ + offset : nullptr;
+}
+
+OptionBatch ColumnarFile::bookView() const {
+    if (kind() != ColumnarKind::Book) throw std::logic_error("Columnar file is not an option book");
+    return OptionBatch{
+        requireColumn<const double>(column(ColumnId::Strike)),
+        requireColumn<const double>(column(ColumnId::Expiry)),
+        requireColumn<const Option::Type>(column(ColumnId::Type)),
+        requireColumn<const double>(column(ColumnId::Spot)),
+        requireColumn<const double>(column(ColumnId::Rate)),
+        requireColumn<const double>(column(ColumnId::Volatility)),
+        size()
+    };
+}
+
+BatchResults ColumnarFile::resultsView() {
+    if (kind() != ColumnarKind::Results) throw std::logic_error("Columnar file is not a results file");
+    return BatchResults{
+        requireColumn<double>(mutableColumn(ColumnId::Price)),
+        requireColumn<double>(mutableColumn(ColumnId::Delta)),
+        requireColumn<double>(mutableColumn(ColumnId::Gamma)),
+        requireColumn<double>(mutableColumn(ColumnId::Vega)),
+        requireColumn<double>(mutableColumn(ColumnId::Theta)),
+        requireColumn<double>(mutableColumn(ColumnId::Rho))
+    };
+}
+
+void ColumnarFile::sync() {
+    if (writable_ && data_ && ::msync(data_, bytes_, MS_SYNC) != 0) {
+        throw std::runtime_error(std::string{"Cannot sync columnar file: "} + std::strerror(errno));
+    }
+}
@@ -0,0 +1,135 @@
+#include "csv_book.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    constexpr std::size_t read_block_bytes = 1 << 20;
+
+    std::string_view trim(std::string_view text) {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) text.remove_suffix(1);
+        return text;
+    }
+
+    // Splits off the next comma-separated field
+    std::string_view nextField(std::string_view &rest) {
+        const std::size_t comma = rest.find(',');
+        const std::string_view field = trim(rest.substr(0, comma));
+        rest = comma == std::string_view::npos ? std::string_view{} : rest.substr(comma + 1);
+        return field;
+    }
+
+    bool parseNumber(const std::string_view field, double &value) {
+        const char *last = field.data() + field.size();
+        const auto [end, error] = std::from_chars(field.data(), last, value);
+        return error == std::errc{} && end == last && std::isfinite(value);
+    }
+
+    // Case-insensitive match against a lower-case word
+    bool equalsWord(const std::string_view field, const std::string_view word) {
+        return field.size() == word.size()
+               && std::equal(field.begin(), field.end(), word.begin(), [](const char a, const char b) {
+                   return (a | 0x20) == b;
+               });
+    }
+
+    bool parseType(const std::string_view field, Option::Type &type) {
+        const auto equals = [&](const std::string_view word) { return equalsWord(field, word); };
+        if (equals("call") || equals("c")) {
+            type = Option::Type::CALL;
+            return true;
+        }
+        if (equals("put") || equals("p")) {
+            type = Option::Type::PUT;
+            return true;
+        }
+        return false;
+    }
+
+    [[noreturn]] void rejectLine(const std::uint64_t line, const std::string &reason) {
+        throw std::invalid_argument("Book line " + std::to_string(line) + ": " + reason);
+    }
+}
+
+CsvBookReader::CsvBookReader(std::FILE *file)
+    : file_{file}, buffer_(read_block_bytes) {
+    if (!file_) throw std::invalid_argument("Book input must be an open file");
+}
+
+bool CsvBookReader::nextLine(std::string_view &line) {
+    while (true) {
+        const char *start = buffer_.data() + begin_;
+        const auto *newline = static_cast<const char *>(std::memchr(start, '\n', end_ - begin_));
+        if (newline) {
+            line = std::string_view{start, static_cast<std::size_t>(newline - start)};
+            begin_ += line.size() + 1;
+            return true;
+        }
+        if (eof_) {
+            if (begin_ == end_) return false;
+            line = std::string_view{start, end_ - begin_};
+            begin_ = end_;
+            return true;
+        }
+
+        // Keep the partial line, grow only for a line longer than the buffer
+        std::memmove(buffer_.data(), start, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+        if (end_ == buffer_.size()) buffer_.resize(2 * buffer_.size());
+
+        const std::size_t read = std::fread(buffer_.data() + end_, 1, buffer_.size() - end_, file_);
+        if (read == 0) {
+            if (std::ferror(file_)) throw std::runtime_error("Failed reading book input");
+            eof_ = true;
+        }
+        end_ += read;
+        bytes_read_ += read;
+    }
+}
+
+bool CsvBookReader::next(CsvOptionRow &row) {
+    std::string_view line;
+
+    while (nextLine(line)) {
+        ++line_number_;
+        line = trim(line);
+        if (line.empty() || line.front() == '#') continue;
+
+        std::string_view rest = line;
+
+        // Only a row naming its first column `spot` is a header; a malformed first data row is rejected
+        if (!past_header_) {
+            past_header_ = true;
+            std::string_view header = rest;
+            if (equalsWord(nextField(header), "spot")) continue;
+        }
+
+        double values[5];
+        bool numeric = true;
+        for (double &value: values) {
+            numeric = numeric && parseNumber(nextField(rest), value);
+        }
+        const std::string_view type_field = nextField(rest);
+
+        if (!numeric) rejectLine(line_number_, "expected spot,strike,rate,volatility,expiry,type");
+        if (!parseType(type_field, row.type)) rejectLine(line_number_, "type must be call or put");
+        if (!rest.empty()) rejectLine(line_number_, "too many fields");
+        if (!(values[0] > 0 && values[1] > 0 && values[3] > 0 && values[4] > 0)) {
+            rejectLine(line_number_, "spot, strike, volatility and expiry must be positive");
+        }
+
+        row.line = line_number_;
+        row.spot = values[0];
+        row.strike = values[1];
+        row.rate = values[2];
+        row.volatility = values[3];
+        row.expiry = values[4];
+        return true;
+    }
+    return false;
+}
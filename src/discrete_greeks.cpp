@@ -1,120 +1,47 @@
 #include "discrete_greeks.h"
+#include "instrumentation.h"
+#include <vector>
 
-Greeks FiniteDifferenceGreeks::calculate(
-    const Option &option,
-    const MarketParameters &market_parameters
-) const {
-    Greeks greeks;
-
-    const double base_price = engine_.price(option, market_parameters).price;
-
-    greeks.delta = calculateDelta(option, market_parameters, base_price);
-    greeks.gamma = calculateGamma(option, market_parameters);
-    greeks.vega = calculateVega(option, market_parameters, base_price);
-    greeks.theta = calculateTheta(option, market_parameters, base_price);
-    greeks.rho = calculateRho(option, market_parameters, base_price);
-
-    return greeks;
-}
-
-double FiniteDifferenceGreeks::calculateDelta(
-    const Option &option,
-    const MarketParameters &market_parameters,
-    const double base_price
-) const {
-    const double finite_incr = market_parameters.spot_price * epsilon_;
-
-    const MarketParameters market_up{
-        market_parameters.spot_price + finite_incr,
-        market_parameters.risk_free_rate,
-        market_parameters.volatility
-    };
-
-    const double price_incr = engine_.price(option, market_up).price;
-
-    return (price_incr - base_price) / finite_incr;
+namespace {
+    // Positions of each bump in the scenario list
+    enum Scenario : std::size_t { BASE, SPOT_UP, SPOT_DOWN, VOL_UP, RATE_UP, LESS_TIME };
 }
 
-double FiniteDifferenceGreeks::calculateGamma(
+Greeks FiniteDifferenceGreeks::calculate(
     const Option &option,
     const MarketParameters &market_parameters
 ) const {
-    const double finite_incr = market_parameters.spot_price * epsilon_;
-
-    const MarketParameters market_up{
-        market_parameters.spot_price + finite_incr,
-        market_parameters.risk_free_rate,
-        market_parameters.volatility
-    };
-
-    const MarketParameters market_down{
-        market_parameters.spot_price - finite_incr,
-        market_parameters.risk_free_rate,
-        market_parameters.volatility
-    };
-
-    const double price_up = engine_.price(option, market_up).price;
-    const double price_center = engine_.price(option, market_parameters).price;
-    const double price_down = engine_.price(option, market_down).price;
-
-    return (price_up - 2 * price_center + price_down) / (finite_incr * finite_incr);
-}
-
-double FiniteDifferenceGreeks::calculateVega(
-    const Option &option,
-    const MarketParameters &market_parameters,
-    const double base_price
-) const {
-    const double vol_up = epsilon_;
-
-    const MarketParameters market_vol_up{
-        market_parameters.spot_price,
-        market_parameters.risk_free_rate,
-        market_parameters.volatility + vol_up
-    };
-
-    const double price = engine_.price(option, market_vol_up).price;
-
-    return (price - base_price) / vol_up / 100.0;
-}
-
-double FiniteDifferenceGreeks::calculateTheta(
-    const Option &option,
-    const MarketParameters &market_parameters,
-    const double base_price
-) const {
+    PRICING_SCOPE(Probe::FiniteDifferenceGreeks);
     constexpr double time_bump = 1 / 365.0;
 
-    if (option.getExpiry() <= time_bump) {
-        return 0.0;
-    }
-
-    const Option option_less_time{
-        option.getStrike(),
-        option.getType(),
-        option.getExpiry() - time_bump
-    };
-
-    const double price_less_time = engine_.price(option_less_time, market_parameters).price;
-
-    return (price_less_time - base_price) / time_bump / 365.0;
-}
-
-double FiniteDifferenceGreeks::calculateRho(
-    const Option &option,
-    const MarketParameters &market_parameters,
-    const double base_price
-) const {
+    const double spot_bump = market_parameters.spot_price * epsilon_;
+    const double vol_bump = epsilon_;
     const double rate_bump = epsilon_;
-
-    const MarketParameters market_rate_up{
-        market_parameters.spot_price,
-        market_parameters.risk_free_rate + rate_bump,
-        market_parameters.volatility
+    const bool has_theta = option.getExpiry() > time_bump;
+
+    std::vector<BumpScenario> scenarios{
+        BumpScenario{},
+        BumpScenario{spot_bump, 0.0, 0.0, 0.0},
+        BumpScenario{-spot_bump, 0.0, 0.0, 0.0},
+        BumpScenario{0.0, vol_bump, 0.0, 0.0},
+        BumpScenario{0.0, 0.0, rate_bump, 0.0}
     };
+    if (has_theta) {
+        scenarios.push_back(BumpScenario{0.0, 0.0, 0.0, -time_bump});
+    }
 
-    const double price_up = engine_.price(option, market_rate_up).price;
+    const std::vector<double> prices = [&] {
+        PRICING_SCOPE(Probe::FiniteDifferenceBumps);
+        return engine_.priceScenarios(option, market_parameters, scenarios);
+    }();
+    const double base_price = prices[BASE];
 
-    return (price_up - base_price) / rate_bump / 100.0;
-}
+    Greeks greeks;
+    greeks.delta = (prices[SPOT_UP] - prices[SPOT_DOWN]) / (2 * spot_bump);
+    greeks.gamma = (prices[SPOT_UP] - 2 * base_price + prices[SPOT_DOWN]) / (spot_bump * spot_bump);
+    greeks.vega = (prices[VOL_UP] - base_price) / vol_bump / 100.0;
+    greeks.theta = has_theta ? (prices[LESS_TIME] - base_price) / time_bump / 365.0 : 0.0;
+    greeks.rho = (prices[RATE_UP] - base_price) / rate_bump / 100.0;
 
+    return greeks;
+}
@@ -0,0 +1,241 @@
+#include "implied_volatility.h"
+#include "financial_math.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    using Simd::DoubleVec;
+
+    constexpr std::size_t lanes = DoubleVec::width;
+    constexpr double inv_sqrt_2pi = 0.3989422804014327;
+    constexpr double sqrt_three = 1.7320508075688772;
+    constexpr double two_pi = 6.283185307179586;
+
+    // Smallest normal double; time values below it cannot be inverted
+    constexpr double min_time_value = std::numeric_limits<double>::min();
+
+    // Normalized out-of-the-money call, x <= 0: e^{x/2} N(x/s + s/2) - e^{-x/2} N(x/s - s/2)
+    template<typename T>
+    T normalizedPrice(const T x, const T s) {
+        const T ratio = x / s;
+        const T half_s = 0.5 * s;
+        return Simd::exp(0.5 * x) * FinancialMath::normalCDF(ratio + half_s)
+               - Simd::exp(-0.5 * x) * FinancialMath::normalCDF(ratio - half_s);
+    }
+
+    // Abramowitz & Stegun 26.2.23 for 0 < p <= 0.5 (|error| < 4.5e-4), only used for starting points
+    template<typename T>
+    T lowerQuantile(const T p) {
+        const T t = Simd::sqrt(-2.0 * Simd::log(p));
+        const T numerator = Simd::fma(Simd::fma(0.010328, t, 0.802853), t, 2.515517);
+        const T denominator = Simd::fma(Simd::fma(Simd::fma(0.001308, t, 0.189269), t, 1.432788), t, 1.0);
+        return numerator / denominator - t;
+    }
+
+    /**
+     * Total volatility s for an out-of-the-money normalized time value, x <= 0 and 0 < beta < e^{x/2}
+     * - iterations returns, per lane, the iteration whose step fell below the tolerance
+     *   (max_iterations + 1 if none did)
+     */
+    template<typename T>
+    T solveNormalized(const T x, const T beta, const int max_iterations, T &iterations) {
+        const T abs_x = -x;
+        const T x2 = x * x;
+        const T s_c = Simd::max(Simd::sqrt(2.0 * abs_x), 1e-8);
+        const T b_max = Simd::exp(0.5 * x);
+        const auto lower = beta < normalizedPrice(x, s_c);
+
+        // Lower branch: b ~ 2 pi |x| / (3 sqrt 3) N(-|x| / (sqrt 3 s))^3, exact as s -> 0
+        const T cube = beta * (3.0 * sqrt_three / two_pi) / abs_x;
+        const T z_lower = lowerQuantile(Simd::min(Simd::exp(Simd::log(cube) * (1.0 / 3.0)), 0.5));
+        const T guess_lower = Simd::min(Simd::select(z_lower < 0.0, abs_x / (-sqrt_three * z_lower), s_c), s_c);
+
+        // Upper branch: at the money b = 1 - 2 N(-s / 2), rescaled to the maximum e^{x/2}
+        const T z_upper = lowerQuantile(0.5 * (b_max - beta) / b_max);
+        const T guess_upper = Simd::max(-2.0 * z_upper, s_c);
+
+        const T log_beta = Simd::log(beta);
+        T s = Simd::select(lower, guess_lower, guess_upper);
+        T last_large_step = 0.0;
+
+        for (int iteration = 1; iteration <= max_iterations; ++iteration) {
+            const T b = normalizedPrice(x, s);
+            const T inv_s = 1.0 / s;
+            const T inv_s2 = inv_s * inv_s;
+
+            // Normalized vega b' and the ratios b''/b', b'''/b'
+            const T vega = Simd::exp(Simd::fma(-0.5 * x2, inv_s2, -0.125 * s * s)) * inv_sqrt_2pi;
+            const T h2 = x2 * inv_s2 * inv_s - 0.25 * s;
+            const T h3 = h2 * h2 - 3.0 * x2 * inv_s2 * inv_s2 - 0.25;
+
+            // Lower branch solves ln b = ln beta: f' = r, f''/f' = h2 - r, f'''/f' = h3 - 3 r h2 + 2 r^2
+            const T r = vega / b;
+            const T newton = Simd::select(lower, (log_beta - Simd::log(b)) / r, (beta - b) / vega);
+            const T g2 = Simd::select(lower, h2 - r, h2);
+            const T g3 = Simd::select(lower, h3 - r * (3.0 * h2 - 2.0 * r), h3);
+
+            // Third-order Householder step
+            const T step = newton * Simd::fma(0.5 * g2, newton, 1.0)
+                           / Simd::fma(newton, Simd::fma(g3 * (1.0 / 6.0), newton, g2), 1.0);
+
+            // Each branch stays on its side of the inflection point
+            const T next = Simd::max(s + step, 0.25 * s);
+            s = Simd::select(lower, Simd::min(next, s_c), Simd::max(next, s_c));
+
+            const auto large = Simd::abs(step) > ImpliedVolatilitySolver::RELATIVE_STEP_TOLERANCE * s;
+            last_large_step = Simd::select(large, static_cast<double>(iteration), last_large_step);
+            if (!Simd::any(large)) break;
+        }
+
+        iterations = last_large_step + 1.0;
+        return s;
+    }
+
+    template<typename T>
+    struct Inversion {
+        T volatility;
+        T time_value;
+        T max_time_value;
+        T iterations;
+    };
+
+    // Maps a quote to the normalized out-of-the-money problem and solves it; omega = +1 call, -1 put
+    template<typename T>
+    Inversion<T> invert(
+        const T price,
+        const T strike,
+        const T expiry,
+        const T spot,
+        const T rate,
+        const T omega,
+        const int max_iterations
+    ) {
+        const T growth = Simd::exp(rate * expiry);
+        const T forward = spot * growth;
+        const T x = Simd::log(forward / strike);
+        const T beta = price * growth / Simd::sqrt(forward * strike);
+
+        const T half = Simd::exp(0.5 * x);
+        const T intrinsic = Simd::max(omega * (half - 1.0 / half), 0.0);
+        const T x_otm = -Simd::abs(x);
+
+        Inversion<T> out;
+        out.time_value = beta - intrinsic;
+        out.max_time_value = Simd::exp(0.5 * x_otm);
+
+        // Lanes without a solution get a benign problem, classify() reports them
+        const auto valid = (out.time_value > min_time_value) & (out.max_time_value > out.time_value);
+        const T safe_x = Simd::select(valid, x_otm, -1.0);
+        const T safe_beta = Simd::select(valid, out.time_value, 0.1);
+
+        const T total_volatility = solveNormalized(safe_x, safe_beta, max_iterations, out.iterations);
+        out.volatility = total_volatility / Simd::sqrt(expiry);
+        return out;
+    }
+
+    ImpliedVolatilityResult classify(
+        const double price,
+        const double strike,
+        const double expiry,
+        const double spot,
+        const double rate,
+        const Inversion<double> &inversion,
+        const int max_iterations
+    ) {
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+        if (!(spot > 0 && strike > 0 && expiry > 0) || !std::isfinite(price) || !std::isfinite(rate)
+            || !std::isfinite(spot) || !std::isfinite(strike) || !std::isfinite(expiry)) {
+            return {nan, ImpliedVolatilityStatus::InvalidInput, 0};
+        }
+        if (!(inversion.time_value > min_time_value)) {
+            return {nan, ImpliedVolatilityStatus::PriceBelowIntrinsic, 0};
+        }
+        if (!(inversion.max_time_value > inversion.time_value)) {
+            return {nan, ImpliedVolatilityStatus::PriceAboveMaximum, 0};
+        }
+
+        const int iterations = static_cast<int>(inversion.iterations);
+        if (iterations > max_iterations || !std::isfinite(inversion.volatility)) {
+            return {inversion.volatility, ImpliedVolatilityStatus::NotConverged, max_iterations};
+        }
+        return {inversion.volatility, ImpliedVolatilityStatus::Converged, iterations};
+    }
+
+    // Solves batch[offset, offset + count), count <= lanes; a partial tail is padded with a benign quote
+    void solveChunk(
+        const ImpliedVolatilityBatch &batch,
+        const ImpliedVolatilityResults &results,
+        const std::size_t offset,
+        const std::size_t count,
+        const int max_iterations
+    ) {
+        double omega[lanes];
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            omega[lane] = (lane < count && batch.type[offset + lane] == Option::Type::PUT) ? -1.0 : 1.0;
+        }
+
+        const Inversion<DoubleVec> out = invert<DoubleVec>(
+            Simd::loadPartial(batch.price + offset, count, 0.1),
+            Simd::loadPartial(batch.strike + offset, count, 1.0),
+            Simd::loadPartial(batch.expiry + offset, count, 1.0),
+            Simd::loadPartial(batch.spot + offset, count, 1.0),
+            Simd::loadPartial(batch.rate + offset, count, 0.0),
+            DoubleVec::load(omega),
+            max_iterations
+        );
+
+        double volatility[lanes];
+        double time_value[lanes];
+        double max_time_value[lanes];
+        double iterations[lanes];
+        out.volatility.store(volatility);
+        out.time_value.store(time_value);
+        out.max_time_value.store(max_time_value);
+        out.iterations.store(iterations);
+
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            const std::size_t i = offset + lane;
+            const Inversion<double> lane_inversion{volatility[lane], time_value[lane], max_time_value[lane], iterations[lane]};
+            const ImpliedVolatilityResult result = classify(
+                batch.price[i], batch.strike[i], batch.expiry[i], batch.spot[i], batch.rate[i],
+                lane_inversion, max_iterations
+            );
+
+            results.volatility[i] = result.volatility;
+            results.status[i] = result.status;
+            if (results.iterations) results.iterations[i] = result.iterations;
+        }
+    }
+}
+
+ImpliedVolatilitySolver::ImpliedVolatilitySolver(const int max_iterations)
+    : max_iterations_{max_iterations} {
+    if (max_iterations_ < 1) throw std::invalid_argument("Iteration limit must be positive");
+}
+
+ImpliedVolatilityResult ImpliedVolatilitySolver::solve(
+    const Option &option,
+    const double price,
+    const double spot,
+    const double rate
+) const {
+    const double strike = option.getStrike();
+    const double expiry = option.getExpiry();
+    const double omega = option.getType() == Option::Type::CALL ? 1.0 : -1.0;
+
+    const Inversion<double> inversion = invert<double>(price, strike, expiry, spot, rate, omega, max_iterations_);
+    return classify(price, strike, expiry, spot, rate, inversion, max_iterations_);
+}
+
+void ImpliedVolatilitySolver::solveBatch(const ImpliedVolatilityBatch &batch, const ImpliedVolatilityResults &results) const {
+    std::size_t offset = 0;
+    for (; offset + lanes <= batch.size; offset += lanes) {
+        solveChunk(batch, results, offset, lanes, max_iterations_);
+    }
+
+    if (offset < batch.size) {
+        solveChunk(batch, results, offset, batch.size - offset, max_iterations_);
+    }
+}
@@ -0,0 +1,306 @@
+#include "instrumentation.h"
+#include "latency_histogram.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+namespace {
+    constexpr std::size_t probe_count = static_cast<std::size_t>(Probe::Count);
+
+    // Only the owning thread writes; a plain load + store keeps the hot path free of locked instructions
+    void increment(std::atomic<std::uint64_t> &counter, const std::uint64_t amount) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    struct ProbeCounters {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> total_ns{0};
+        std::atomic<std::uint64_t> max_ns{0};
+        std::array<std::atomic<std::uint64_t>, HdrBuckets::count> buckets{};
+    };
+
+    // Plain copy of one probe's counters: a reset baseline, the retired total or a merged view
+    struct ProbeTotals {
+        std::uint64_t count{0};
+        std::uint64_t total_ns{0};
+        std::uint64_t max_ns{0};
+        std::array<std::uint64_t, HdrBuckets::count> buckets{};
+    };
+
+    // Bumped by reset(); a recorder whose generation lags has a pre-reset max_ns
+    std::atomic<std::uint64_t> reset_generation{0};
+
+    struct ThreadRecorder {
+        std::uint32_t thread_id;
+        std::atomic<std::uint64_t> generation{0};              // written by the owning thread
+        std::array<ProbeCounters, probe_count> probes;
+        std::array<ProbeTotals, probe_count> baseline{};        // counters at the last reset, under the registry mutex
+        bool live{false};                                       // owned by a thread, under the registry mutex
+
+        explicit ThreadRecorder(const std::uint32_t id) : thread_id{id} {}
+    };
+
+    // Recorders are recycled through the free list when their thread exits, after folding their
+    // counts into retired, so the registry grows only to the peak number of recording threads
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadRecorder>> recorders;
+        std::vector<ThreadRecorder *> free;
+        std::vector<ProbeTotals> retired = std::vector<ProbeTotals>(probe_count);
+    };
+
+    Registry &registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    // Adds a recorder's counts since the last reset; the caller holds the registry mutex
+    void accumulate(const ThreadRecorder &recorder, std::vector<ProbeTotals> &into) {
+        const bool current = recorder.generation.load(std::memory_order_acquire)
+                             == reset_generation.load(std::memory_order_relaxed);
+        for (std::size_t p = 0; p < probe_count; ++p) {
+            const ProbeCounters &counters = recorder.probes[p];
+            const ProbeTotals &baseline = recorder.baseline[p];
+            ProbeTotals &totals = into[p];
+
+            totals.count += counters.count.load(std::memory_order_relaxed) - baseline.count;
+            totals.total_ns += counters.total_ns.load(std::memory_order_relaxed) - baseline.total_ns;
+            if (current) totals.max_ns = std::max(totals.max_ns, counters.max_ns.load(std::memory_order_relaxed));
+            for (std::size_t b = 0; b < HdrBuckets::count; ++b) {
+                totals.buckets[b] += counters.buckets[b].load(std::memory_order_relaxed) - baseline.buckets[b];
+            }
+        }
+    }
+
+    ThreadRecorder *acquireRecorder() {
+        Registry &shared = registry();
+        const std::lock_guard lock{shared.mutex};
+
+        ThreadRecorder *recorder;
+        if (!shared.free.empty()) {
+            recorder = shared.free.back();
+            shared.free.pop_back();
+        } else {
+            const auto id = static_cast<std::uint32_t>(shared.recorders.size());
+            shared.recorders.push_back(std::make_unique<ThreadRecorder>(id));
+            recorder = shared.recorders.back().get();
+        }
+        recorder->live = true;
+        recorder->generation.store(reset_generation.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return recorder;
+    }
+
+    // Called by the owning thread as it exits, so zeroing its counters races with no writer
+    void retireRecorder(ThreadRecorder &recorder) {
+        Registry &shared = registry();
+        const std::lock_guard lock{shared.mutex};
+
+        accumulate(recorder, shared.retired);
+        for (ProbeCounters &counters: recorder.probes) {
+            counters.count.store(0, std::memory_order_relaxed);
+            counters.total_ns.store(0, std::memory_order_relaxed);
+            counters.max_ns.store(0, std::memory_order_relaxed);
+            for (auto &bucket: counters.buckets) bucket.store(0, std::memory_order_relaxed);
+        }
+        recorder.baseline.fill(ProbeTotals{});
+        recorder.live = false;
+        shared.free.push_back(&recorder);
+    }
+
+    thread_local ThreadRecorder *local_recorder = nullptr;
+
+    // Hands the thread's recorder back on thread exit
+    struct RecorderLease {
+        ~RecorderLease() {
+            if (local_recorder) retireRecorder(*local_recorder);
+            local_recorder = nullptr;
+        }
+    };
+
+    ThreadRecorder &localRecorder() {
+        if (!local_recorder) {
+            local_recorder = acquireRecorder();
+            thread_local RecorderLease lease;
+            static_cast<void>(lease);
+        }
+        return *local_recorder;
+    }
+
+    struct TraceEvent {
+        std::uint64_t start_ns;
+        std::uint64_t duration_ns;
+        std::uint32_t thread_id;
+        Probe probe;
+    };
+
+    struct TraceBuffer {
+        std::vector<TraceEvent> events;
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> active{false};
+        std::uint64_t epoch_ns{0};
+    };
+
+    TraceBuffer &traceBuffer() {
+        static TraceBuffer instance;
+        return instance;
+    }
+
+    // Microseconds with three decimals, independent of the stream's formatting state
+    void writeMicroseconds(std::ostream &out, const std::uint64_t nanoseconds) {
+        char text[32];
+        std::snprintf(text, sizeof(text), "%llu.%03llu",
+                      static_cast<unsigned long long>(nanoseconds / 1000),
+                      static_cast<unsigned long long>(nanoseconds % 1000));
+        out << text;
+    }
+}
+
+const char *probeName(const Probe probe) {
+    switch (probe) {
+        case Probe::BlackScholesPrice: return "bs.price";
+        case Probe::BlackScholesGreeks: return "bs.greeks";
+        case Probe::BlackScholesCompact: return "bs.compact";
+        case Probe::BlackScholesBatch: return "bs.batch";
+        case Probe::MonteCarloPrice: return "mc.price";
+        case Probe::MonteCarloRng: return "mc.rng";
+        case Probe::MonteCarloPayoff: return "mc.payoff";
+        case Probe::MonteCarloStatistics: return "mc.statistics";
+        case Probe::MonteCarloResult: return "mc.result";
+        case Probe::FiniteDifferenceGreeks: return "fd.greeks";
+        case Probe::FiniteDifferenceBumps: return "fd.bumps";
+        default: return "unknown";
+    }
+}
+
+namespace Instrumentation {
+    std::uint64_t now() {
+        const auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count());
+    }
+
+    void record(const Probe probe, const std::uint64_t start_ns, const std::uint64_t duration_ns) {
+        ThreadRecorder &recorder = localRecorder();
+
+        // First record after a reset: drop this thread's pre-reset maxima before adding to them
+        const std::uint64_t generation = reset_generation.load(std::memory_order_relaxed);
+        if (recorder.generation.load(std::memory_order_relaxed) != generation) {
+            for (ProbeCounters &probe_counters: recorder.probes) probe_counters.max_ns.store(0, std::memory_order_relaxed);
+            recorder.generation.store(generation, std::memory_order_release);
+        }
+
+        ProbeCounters &counters = recorder.probes[static_cast<std::size_t>(probe)];
+
+        increment(counters.count, 1);
+        increment(counters.total_ns, duration_ns);
+        increment(counters.buckets[HdrBuckets::index(duration_ns)], 1);
+        if (duration_ns > counters.max_ns.load(std::memory_order_relaxed)) {
+            counters.max_ns.store(duration_ns, std::memory_order_relaxed);
+        }
+
+        TraceBuffer &trace = traceBuffer();
+        if (trace.active.load(std::memory_order_acquire)) {
+            const std::size_t slot = trace.next.fetch_add(1, std::memory_order_relaxed);
+            if (slot < trace.events.size()) {
+                trace.events[slot] = TraceEvent{start_ns, duration_ns, recorder.thread_id, probe};
+            }
+        }
+    }
+
+    std::vector<ProbeStatistics> statistics() {
+        std::vector<ProbeTotals> merged;
+
+        Registry &shared = registry();
+        {
+            const std::lock_guard lock{shared.mutex};
+            merged = shared.retired;
+            for (const auto &recorder: shared.recorders) {
+                if (recorder->live) accumulate(*recorder, merged);
+            }
+        }
+
+        std::vector<ProbeStatistics> result;
+        for (std::size_t p = 0; p < probe_count; ++p) {
+            const ProbeTotals &totals = merged[p];
+            std::uint64_t histogram_count = 0;
+            for (const std::uint64_t bucket: totals.buckets) histogram_count += bucket;
+            if (totals.count == 0 || histogram_count == 0) continue;
+
+            const auto max_ns = static_cast<double>(totals.max_ns);
+            const auto quantile = [&](const double fraction) {
+                return HdrBuckets::percentile(totals.buckets, histogram_count, fraction, max_ns);
+            };
+
+            const auto count = static_cast<double>(totals.count);
+            result.push_back(ProbeStatistics{
+                static_cast<Probe>(p), totals.count, static_cast<double>(totals.total_ns),
+                static_cast<double>(totals.total_ns) / count,
+                quantile(0.5), quantile(0.9), quantile(0.99), max_ns
+            });
+        }
+        return result;
+    }
+
+    // Never writes another thread's counters: it records where they stand, and maxima restart
+    // through the generation each owning thread checks on its next record()
+    void reset() {
+        Registry &shared = registry();
+        const std::lock_guard lock{shared.mutex};
+        for (const auto &recorder: shared.recorders) {
+            if (!recorder->live) continue;
+            for (std::size_t p = 0; p < probe_count; ++p) {
+                const ProbeCounters &counters = recorder->probes[p];
+                ProbeTotals &baseline = recorder->baseline[p];
+                baseline.count = counters.count.load(std::memory_order_relaxed);
+                baseline.total_ns = counters.total_ns.load(std::memory_order_relaxed);
+                for (std::size_t b = 0; b < HdrBuckets::count; ++b) {
+                    baseline.buckets[b] = counters.buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        shared.retired.assign(probe_count, ProbeTotals{});
+        reset_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void startTrace(const std::size_t capacity) {
+        TraceBuffer &trace = traceBuffer();
+        trace.active.store(false, std::memory_order_release);
+        trace.events.assign(capacity, TraceEvent{});
+        trace.next.store(0, std::memory_order_relaxed);
+        trace.epoch_ns = now();
+        trace.active.store(true, std::memory_order_release);
+    }
+
+    void stopTrace() {
+        traceBuffer().active.store(false, std::memory_order_release);
+    }
+
+    std::size_t droppedTraceEvents() {
+        const TraceBuffer &trace = traceBuffer();
+        const std::size_t recorded = trace.next.load(std::memory_order_relaxed);
+        return recorded > trace.events.size() ? recorded - trace.events.size() : 0;
+    }
+
+    std::size_t writeChromeTrace(std::ostream &out) {
+        const TraceBuffer &trace = traceBuffer();
+        const std::size_t count = std::min(trace.next.load(std::memory_order_acquire), trace.events.size());
+
+        out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+        for (std::size_t i = 0; i < count; ++i) {
+            const TraceEvent &event = trace.events[i];
+            const std::uint64_t start = event.start_ns > trace.epoch_ns ? event.start_ns - trace.epoch_ns : 0;
+
+            out << "  {\"name\": \"" << probeName(event.probe) << "\", \"cat\": \"pricing\", \"ph\": \"X\", "
+                << "\"pid\": 1, \"tid\": " << event.thread_id << ", \"ts\": ";
+            writeMicroseconds(out, start);
+            out << ", \"dur\": ";
+            writeMicroseconds(out, event.duration_ns);
+            out << "}" << (i + 1 < count ? "," : "") << "\n";
+        }
+        out << "]}\n";
+        return count;
+    }
+}
@@ -0,0 +1,260 @@
+#include "lattice.h"
+#include "financial_math.h"
+#include "simd.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+    using Simd::DoubleVec;
+
+    constexpr int lanes = DoubleVec::width;
+    constexpr double days_per_year = 365.0;
+
+    // Node values and node spots, reused by every pricing on the thread
+    thread_local std::vector<double> lattice_values;
+    thread_local std::vector<double> lattice_spots;
+
+    // Peizer-Pratt inversion (method 2): binomial probability matching N(z) over n steps, n odd
+    double peizerPratt(const double z, const double n) {
+        const double ratio = z / (n + 1.0 / 3.0 + 0.1 / (n + 1.0));
+        return 0.5 + std::copysign(0.5, z) * std::sqrt(1.0 - std::exp(-ratio * ratio * (n + 1.0 / 6.0)));
+    }
+
+    /**
+     * One binomial step back, nodes [0, count) of step i from nodes [0, count] of step i + 1
+     * - Node spots move from step i + 1 to step i as S / d (only tracked for early exercise)
+     * - Weights include the one-step discount factor
+     */
+    template<bool American>
+    void binomialStep(
+        double *values,
+        double *spots,
+        const int count,
+        const double up_weight,
+        const double down_weight,
+        const double inv_down,
+        const double omega,
+        const double strike
+    ) {
+        int j = 0;
+        for (; j + lanes <= count; j += lanes) {
+            DoubleVec value = Simd::fma(up_weight, DoubleVec::load(values + j + 1), down_weight * DoubleVec::load(values + j));
+            if constexpr (American) {
+                const DoubleVec spot = DoubleVec::load(spots + j) * inv_down;
+                spot.store(spots + j);
+                value = Simd::max(value, omega * (spot - strike));
+            }
+            value.store(values + j);
+        }
+
+        for (; j < count; ++j) {
+            double value = up_weight * values[j + 1] + down_weight * values[j];
+            if constexpr (American) {
+                spots[j] *= inv_down;
+                value = std::max(value, omega * (spots[j] - strike));
+            }
+            values[j] = value;
+        }
+    }
+
+    // One trinomial step back, nodes [0, count) from nodes [0, count + 2]; spots are the step's node spots
+    template<bool American>
+    void trinomialStep(
+        double *values,
+        const double *spots,
+        const int count,
+        const double up_weight,
+        const double middle_weight,
+        const double down_weight,
+        const double omega,
+        const double strike
+    ) {
+        int k = 0;
+        for (; k + lanes <= count; k += lanes) {
+            DoubleVec value = Simd::fma(
+                up_weight, DoubleVec::load(values + k + 2),
+                Simd::fma(middle_weight, DoubleVec::load(values + k + 1), down_weight * DoubleVec::load(values + k))
+            );
+            if constexpr (American) {
+                value = Simd::max(value, omega * (DoubleVec::load(spots + k) - strike));
+            }
+            value.store(values + k);
+        }
+
+        for (; k < count; ++k) {
+            double value = up_weight * values[k + 2] + middle_weight * values[k + 1] + down_weight * values[k];
+            if constexpr (American) {
+                value = std::max(value, omega * (spots[k] - strike));
+            }
+            values[k] = value;
+        }
+    }
+}
+
+LatticeEngine::LatticeEngine(const LatticeParameters &parameters)
+    : parameters_{parameters} {
+    parameters_.validate();
+    if (parameters_.type == LatticeType::LeisenReimer && parameters_.num_steps % 2 == 0) {
+        ++parameters_.num_steps;
+    }
+}
+
+PricingResult LatticeEngine::price(const Option &option, const MarketParameters &market_parameters) const {
+    market_parameters.validate();
+    if (option.getExpiry() <= 0) throw std::invalid_argument("Expiry must be positive");
+
+    return parameters_.type == LatticeType::Trinomial
+               ? priceTrinomial(option, market_parameters)
+               : priceBinomial(option, market_parameters);
+}
+
+PricingResult LatticeEngine::priceBinomial(const Option &option, const MarketParameters &market_parameters) const {
+    const int steps = parameters_.num_steps;
+    const double spot = market_parameters.spot_price;
+    const double rate = market_parameters.risk_free_rate;
+    const double volatility = market_parameters.volatility;
+    const double strike = option.getStrike();
+    const double expiry = option.getExpiry();
+    const double omega = option.getType() == Option::Type::CALL ? 1.0 : -1.0;
+    const bool american = parameters_.exercise == ExerciseStyle::American;
+
+    const double dt = expiry / steps;
+    const double growth = std::exp(rate * dt);
+
+    double up;
+    double down;
+    double probability;
+    if (parameters_.type == LatticeType::LeisenReimer) {
+        const double d1 = FinancialMath::calculateD1(spot, strike, rate, volatility, expiry);
+        const double d2 = FinancialMath::calculateD2(d1, volatility, expiry);
+        probability = peizerPratt(d2, steps);
+        up = growth * peizerPratt(d1, steps) / probability;
+        down = (growth - probability * up) / (1.0 - probability);
+    } else {
+        up = std::exp(volatility * std::sqrt(dt));
+        down = 1.0 / up;
+        probability = (growth - down) / (up - down);
+    }
+
+    std::vector<double> &values = lattice_values;
+    std::vector<double> &spots = lattice_spots;
+    values.resize(static_cast<std::size_t>(steps) + 1);
+    spots.resize(static_cast<std::size_t>(steps) + 1);
+
+    // Terminal nodes S_0 u^j d^{N - j}
+    const double ratio = up / down;
+    double node_spot = spot * std::pow(down, steps);
+    for (int j = 0; j <= steps; ++j) {
+        spots[j] = node_spot;
+        values[j] = std::max(omega * (node_spot - strike), 0.0);
+        node_spot *= ratio;
+    }
+
+    const double up_weight = probability / growth;
+    const double down_weight = (1.0 - probability) / growth;
+    const double inv_down = 1.0 / down;
+
+    double step_two[3];
+    double step_one[2];
+    for (int i = steps - 1; i >= 0; --i) {
+        if (american) {
+            binomialStep<true>(values.data(), spots.data(), i + 1, up_weight, down_weight, inv_down, omega, strike);
+        } else {
+            binomialStep<false>(values.data(), spots.data(), i + 1, up_weight, down_weight, inv_down, omega, strike);
+        }
+
+        if (i == 2) std::copy(values.begin(), values.begin() + 3, step_two);
+        if (i == 1) std::copy(values.begin(), values.begin() + 2, step_one);
+    }
+    const double value = values[0];
+
+    // Step-two nodes S_0 d^2, S_0 u d, S_0 u^2; theta is corrected for S_0 u d != S_0 (Leisen-Reimer)
+    const double spread = spot * (up - down);
+    const double delta = (step_one[1] - step_one[0]) / spread;
+    const double gamma = ((step_two[2] - step_two[1]) / (up * spread) - (step_two[1] - step_two[0]) / (down * spread))
+                         / (0.5 * spot * (up * up - down * down));
+    const double middle_shift = spot * (up * down - 1.0);
+    const double theta = (step_two[1] - value - delta * middle_shift - 0.5 * gamma * middle_shift * middle_shift)
+                         / (2.0 * dt);
+
+    Greeks greeks;
+    greeks.delta = delta;
+    greeks.gamma = gamma;
+    greeks.theta = theta / days_per_year;
+    return PricingResult{value, greeks, getName()};
+}
+
+PricingResult LatticeEngine::priceTrinomial(const Option &option, const MarketParameters &market_parameters) const {
+    const int steps = parameters_.num_steps;
+    const double spot = market_parameters.spot_price;
+    const double rate = market_parameters.risk_free_rate;
+    const double volatility = market_parameters.volatility;
+    const double strike = option.getStrike();
+    const double omega = option.getType() == Option::Type::CALL ? 1.0 : -1.0;
+    const bool american = parameters_.exercise == ExerciseStyle::American;
+
+    const double dt = option.getExpiry() / steps;
+    const double dx = volatility * std::sqrt(3.0 * dt);
+    const double drift = rate - 0.5 * volatility * volatility;
+
+    // Probabilities matching the mean and variance of the log-spot step
+    const double second_moment = (volatility * volatility * dt + drift * drift * dt * dt) / (dx * dx);
+    const double first_moment = drift * dt / dx;
+    const double discount = std::exp(-rate * dt);
+    const double up_weight = discount * 0.5 * (second_moment + first_moment);
+    const double down_weight = discount * 0.5 * (second_moment - first_moment);
+    const double middle_weight = discount * (1.0 - second_moment);
+
+    const int nodes = 2 * steps + 1;
+    std::vector<double> &values = lattice_values;
+    std::vector<double> &spots = lattice_spots;
+    values.resize(static_cast<std::size_t>(nodes));
+    spots.resize(static_cast<std::size_t>(nodes));
+
+    // Node k of step i sits at S_0 e^{(k - i) dx} = spots[k + N - i], one spot array serves every step
+    const double ratio = std::exp(dx);
+    double node_spot = spot * std::exp(-steps * dx);
+    for (int k = 0; k < nodes; ++k) {
+        spots[k] = node_spot;
+        values[k] = std::max(omega * (node_spot - strike), 0.0);
+        node_spot *= ratio;
+    }
+
+    double step_one[3];
+    for (int i = steps - 1; i >= 0; --i) {
+        const double *step_spots = spots.data() + (steps - i);
+        if (american) {
+            trinomialStep<true>(values.data(), step_spots, 2 * i + 1, up_weight, middle_weight, down_weight, omega, strike);
+        } else {
+            trinomialStep<false>(values.data(), step_spots, 2 * i + 1, up_weight, middle_weight, down_weight, omega, strike);
+        }
+
+        if (i == 1) std::copy(values.begin(), values.begin() + 3, step_one);
+    }
+    const double value = values[0];
+
+    // Step-one nodes S_0 e^{-dx}, S_0, S_0 e^{dx}
+    const double spot_up = spot * ratio;
+    const double spot_down = spot / ratio;
+    const double delta = (step_one[2] - step_one[0]) / (spot_up - spot_down);
+    const double gamma = ((step_one[2] - step_one[1]) / (spot_up - spot) - (step_one[1] - step_one[0]) / (spot - spot_down))
+                         / (0.5 * (spot_up - spot_down));
+
+    Greeks greeks;
+    greeks.delta = delta;
+    greeks.gamma = gamma;
+    greeks.theta = (step_one[1] - value) / dt / days_per_year;
+    return PricingResult{value, greeks, getName()};
+}
+
+std::string LatticeEngine::getName() const {
+    std::string name;
+    switch (parameters_.type) {
+        case LatticeType::CoxRossRubinstein: name = "CRR Binomial"; break;
+        case LatticeType::LeisenReimer: name = "Leisen-Reimer Binomial"; break;
+        case LatticeType::Trinomial: name = "Trinomial"; break;
+    }
+    const char *style = parameters_.exercise == ExerciseStyle::American ? "American" : "European";
+    return name + " (" + std::to_string(parameters_.num_steps) + " steps, " + style + ")";
+}
@@ -1,17 +1,39 @@
 #include "monte_carlo.h"
 #include "option.h"
 #include "black_scholes.h"
-#include "discrete_greeks.h"
+#include "batch_pricer.h"
+#include "columnar_file.h"
+#include "pricing_client.h"
+#include "pricing_server.h"
+#include "timer.h"
+#include <csignal>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
 
 void printUsage() {
-    std::cout << "Usage: ./pricer <spot> <strike> <rate> <vol> <expiry> <type> <method> [paths]\n"
+    std::cout << "Usage: ./pricer <spot> <strike> <rate> <vol> <expiry> <type> <method> [paths] [threads]\n"
             << "  type: call|put\n"
             << "  method: bs|mc\n"
             << "  paths: number of MC paths (default: 100000)\n"
-            << "Example: ./pricer 100 105 0.05 0.2 1.0 call bs\n";
+            << "  threads: MC worker threads, 0 = all cores (default: 1)\n"
+            << "Example: ./pricer 100 105 0.05 0.2 1.0 call bs\n"
+            << "\n"
+            << "Batch:  ./pricer --batch <input.csv|-> <output.csv|-> [method] [paths] [threads] [precision]\n"
+            << "  input rows: spot,strike,rate,vol,expiry,type (optional header starting with spot, - = stdin)\n"
+            << "  output rows: row,price,std_error,delta,gamma,vega,theta,rho (- = stdout)\n"
+            << "  threads: pricing threads, 0 = all cores (default: 0)\n"
+            << "  precision: double|single, single runs float kernels (default: double)\n"
+            << "\n"
+            << "Columnar: ./pricer --convert <input.csv> <book.bin>\n"
+            << "          ./pricer --price-book <book.bin> <results.bin> [method] [paths] [threads] [precision]\n"
+            << "\n"
+            << "Server: ./pricer --serve <socket> [max_delay_us] [threads] [paths]\n"
+            << "  max_delay_us: how long a request waits for others to batch with (default: 200)\n"
+            << "Load:   ./pricer --load <socket> [connections] [requests] [options] [method]\n"
+            << "  requests per connection (default: 4 connections x 1000 requests of 1 option, bs)\n";
 }
 
 Option::Type parseOptionType(const std::string &type_str) {
@@ -61,8 +83,193 @@ void printResult(const PricingResult &result, const Greeks& greeks) {
     }
 }
 
+// Batch modes share: <mode> <input> <output> [method] [paths] [threads] [precision]
+std::string batchMethodName(const int argc, const char *argv[]) {
+    std::string method = argc >= 5 ? argv[4] : "bs";
+    std::transform(method.begin(), method.end(), method.begin(), ::tolower);
+    if (method != "bs" && method != "mc") throw std::invalid_argument("Method must be 'bs' or 'mc'");
+    return method;
+}
+
+BatchPricerParameters batchParameters(const int argc, const char *argv[]) {
+    const int paths = argc >= 6 ? std::stoi(argv[5]) : 100000;
+    const unsigned int threads = argc >= 7 ? static_cast<unsigned int>(std::stoul(argv[6])) : 0;
+    const BatchMethod method = batchMethodName(argc, argv) == "mc" ? BatchMethod::MonteCarlo : BatchMethod::BlackScholes;
+
+    BatchPricerParameters parameters{method, paths, threads};
+    if (argc >= 8) {
+        std::string precision = argv[7];
+        std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
+        if (precision != "double" && precision != "single") throw std::invalid_argument("Precision must be 'double' or 'single'");
+        parameters.precision = precision == "single" ? Precision::Single : Precision::Double;
+    }
+    return parameters;
+}
+
+void printBatchReport(const BatchPricingReport &report, const std::string &method) {
+    std::cerr << std::fixed << std::setprecision(2)
+            << "Priced " << report.options << " options (" << method << ") in " << report.wall_seconds << " s: "
+            << report.optionsPerSecond() << " options/s\n"
+            << "  read " << report.bytes_read / 1e6 << " MB, wrote " << report.bytes_written / 1e6 << " MB\n"
+            << "  stage busy time: parse " << report.parse_seconds << " s, price " << report.price_seconds
+            << " s, format " << report.format_seconds << " s\n";
+}
+
+// Streams a whole CSV book through BatchPricer; the summary goes to stderr so output can be stdout
+int runBatch(const int argc, const char *argv[]) {
+    if (argc < 4) {
+        printUsage();
+        return 1;
+    }
+
+    const std::string method = batchMethodName(argc, argv);
+    const BatchPricer pricer{batchParameters(argc, argv)};
+
+    const bool from_stdin = std::strcmp(argv[2], "-") == 0;
+    const bool to_stdout = std::strcmp(argv[3], "-") == 0;
+    std::FILE *input = from_stdin ? stdin : std::fopen(argv[2], "rb");
+    if (!input) throw std::invalid_argument(std::string{"Cannot open input "} + argv[2]);
+    std::FILE *output = to_stdout ? stdout : std::fopen(argv[3], "wb");
+    if (!output) {
+        if (!from_stdin) std::fclose(input);
+        throw std::invalid_argument(std::string{"Cannot open output "} + argv[3]);
+    }
+
+    BatchPricingReport report;
+    try {
+        report = pricer.run(input, output);
+    } catch (...) {
+        if (!from_stdin) std::fclose(input);
+        if (!to_stdout) std::fclose(output);
+        throw;
+    }
+    if (!from_stdin) std::fclose(input);
+    if (!to_stdout && std::fclose(output) != 0) throw std::runtime_error("Failed closing batch output");
+
+    printBatchReport(report, method);
+    return 0;
+}
+
+// Maps a columnar book, prices it and writes a columnar results file
+int runPriceBook(const int argc, const char *argv[]) {
+    if (argc < 4) {
+        printUsage();
+        return 1;
+    }
+
+    const std::string method = batchMethodName(argc, argv);
+    const BatchPricer pricer{batchParameters(argc, argv)};
+    printBatchReport(pricer.priceBook(argv[2], argv[3]), method);
+    return 0;
+}
+
+int runConvert(const int argc, const char *argv[]) {
+    if (argc < 4) {
+        printUsage();
+        return 1;
+    }
+
+    Timer timer;
+    timer.start();
+    const ColumnarFile book = ColumnarFile::convertCsv(argv[2], argv[3]);
+    std::cerr << std::fixed << std::setprecision(2)
+            << "Converted " << book.size() << " options into " << argv[3] << " (" << book.bytes() / 1e6
+            << " MB) in " << timer.elapsedSeconds() << " s\n";
+    return 0;
+}
+
+PricingServer *active_server = nullptr;
+
+void stopServer(int) {
+    if (active_server) active_server->stop();
+}
+
+void printServerStatistics(const PricingProtocol::WireStatistics &stats) {
+    std::cerr << std::fixed << std::setprecision(1)
+            << "Server: " << stats.requests << " requests, " << stats.options << " options in " << stats.batches
+            << " batches (" << stats.mean_batch_options << " options/batch), " << stats.errors << " errors\n"
+            << "  latency p50 " << stats.p50_us << " us, p99 " << stats.p99_us << " us, max " << stats.max_us << " us\n";
+}
+
+// Serves until SIGINT or SIGTERM, then prints the latency summary
+int runServe(const int argc, const char *argv[]) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+
+    const double delay_us = argc >= 4 ? std::stod(argv[3]) : 200.0;
+    const unsigned int threads = argc >= 5 ? static_cast<unsigned int>(std::stoul(argv[4])) : 0;
+    const int paths = argc >= 6 ? std::stoi(argv[5]) : 100000;
+
+    PricingServer server{PricingServerParameters{argv[2], delay_us, threads, paths}};
+    active_server = &server;
+    std::signal(SIGINT, stopServer);
+    std::signal(SIGTERM, stopServer);
+
+    std::cerr << "Serving on " << argv[2] << " (max batching delay " << delay_us << " us), Ctrl-C to stop\n";
+    try {
+        server.run();
+    } catch (...) {
+        active_server = nullptr;
+        throw;
+    }
+    active_server = nullptr;
+
+    printServerStatistics(server.statistics());
+    return 0;
+}
+
+int runLoad(const int argc, const char *argv[]) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+
+    const unsigned int connections = argc >= 4 ? static_cast<unsigned int>(std::stoul(argv[3])) : 4;
+    const std::size_t requests = argc >= 5 ? std::stoul(argv[4]) : 1000;
+    const std::size_t options = argc >= 6 ? std::stoul(argv[5]) : 1;
+    std::string method = argc >= 7 ? argv[6] : "bs";
+    std::transform(method.begin(), method.end(), method.begin(), ::tolower);
+    if (method != "bs" && method != "mc") throw std::invalid_argument("Method must be 'bs' or 'mc'");
+
+    const LoadGenerator generator{LoadTestParameters{
+        argv[2], connections, requests, options,
+        method == "mc" ? PricingProtocol::Method::MonteCarlo : PricingProtocol::Method::BlackScholes
+    }};
+    const LoadTestReport report = generator.run();
+
+    std::cerr << std::fixed << std::setprecision(1)
+            << "Load: " << report.requests << " requests (" << connections << " connections x " << requests
+            << ", " << options << " options each, " << method << ") in " << std::setprecision(3)
+            << report.wall_seconds << " s: " << std::setprecision(0) << report.requestsPerSecond() << " requests/s, "
+            << report.optionsPerSecond() << " options/s\n"
+            << std::setprecision(1)
+            << "  round trip mean " << report.mean_us << " us, p50 " << report.p50_us << " us, p99 " << report.p99_us
+            << " us, max " << report.max_us << " us\n";
+    printServerStatistics(report.server);
+    return 0;
+}
+
 int main(const int argc, const char *argv[]) {
     try {
+        // Batch mode
+        if (argc >= 2 && std::strcmp(argv[1], "--batch") == 0) {
+            return runBatch(argc, argv);
+        }
+        if (argc >= 2 && std::strcmp(argv[1], "--price-book") == 0) {
+            return runPriceBook(argc, argv);
+        }
+        if (argc >= 2 && std::strcmp(argv[1], "--convert") == 0) {
+            return runConvert(argc, argv);
+        }
+        if (argc >= 2 && std::strcmp(argv[1], "--serve") == 0) {
+            return runServe(argc, argv);
+        }
+        if (argc >= 2 && std::strcmp(argv[1], "--load") == 0) {
+            return runLoad(argc, argv);
+        }
+
         // CLI mode
         if (argc == 2) {
             printUsage();
@@ -83,6 +290,11 @@ int main(const int argc, const char *argv[]) {
                 paths = std::stoi(argv[8]);
             }
 
+            unsigned int threads{1};
+            if (argc >= 10) {
+                threads = static_cast<unsigned int>(std::stoul(argv[9]));
+            }
+
             const Option option{strike, option_type, expiry};
             const MarketParameters market{spot, rate, volatility};
 
@@ -91,14 +303,10 @@ int main(const int argc, const char *argv[]) {
                 const auto result = engine.price(option, market);
                 printResult(result, result.greeks);
             } else if (method == "mc") {
-                const SimulationParameters sim_params{paths, 42};
+                const SimulationParameters sim_params{paths, 42, threads};
                 const MonteCarloEngine engine{sim_params};
                 const auto result = engine.price(option, market);
-
-                FiniteDifferenceGreeks greeks_calc{engine, 0.01};
-                const auto greeks = greeks_calc.calculate(option, market);
-
-                printResult(result, greeks);
+                printResult(result, result.greeks);
             } else {
                 throw std::invalid_argument("Method must be 'bs' or 'mc'");
             }
@@ -123,11 +331,7 @@ int main(const int argc, const char *argv[]) {
             SimulationParameters simulation_parameters{paths, 42};
             const MonteCarloEngine mc_engine{simulation_parameters};
             const auto mc_result = mc_engine.price(call, market);
-
-            FiniteDifferenceGreeks greeks_calc{mc_engine, 0.01};
-            const auto greeks = greeks_calc.calculate(call, market);
-
-            printResult(mc_result, greeks);
+            printResult(mc_result, mc_result.greeks);
         }
     } catch (const std::exception &e) {
         if (argc >= 2) {
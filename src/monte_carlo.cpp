@@ -1,57 +1,486 @@
 #include "monte_carlo.h"
+#include "black_scholes.h"
 #include "financial_math.h"
+#include "instrumentation.h"
+#include "philox.h"
+#include "pricing_kernels.h"
+#include "timer.h"
+#include <algorithm>
 #include <cmath>
-#include <numeric>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
-#include "discrete_greeks.h"
+MonteCarloEngine::MonteCarloEngine(const SimulationParameters &parameters)
+    : simulation_parameters_{parameters} {
+    simulation_parameters_.validate();
+
+    const unsigned int threads = parameters.num_threads == 0 ? ThreadPool::hardwareThreads() : parameters.num_threads;
+    if (threads > 1) {
+        thread_pool_ = std::make_shared<ThreadPool>(threads);
+    }
+}
+
+template<typename Real>
+std::vector<Real> MonteCarloEngine::generateShocks(const std::size_t block) const {
+    PRICING_SCOPE(Probe::MonteCarloRng);
+    const SimulationParameters &params = simulation_parameters_;
+    const std::int64_t first = static_cast<std::int64_t>(block) * PATHS_PER_BLOCK;
+    const std::int64_t last = std::min<std::int64_t>(first + PATHS_PER_BLOCK, params.num_paths);
+    const std::int64_t paths = last - first;
+    const std::int64_t draws = params.antithetic ? (paths + 1) / 2 : paths;
 
-double MonteCarloEngine::simulatePath(const MarketParameters &market, const double expiry) const {
-    const double Z = distribution_(generator_);
-    const double drift = FinancialMath::calculateDriftTerm(market.risk_free_rate, market.volatility, expiry);
-    const double vol_term = FinancialMath::calculateVolatilityTerm(market.volatility, expiry, Z);
+    std::vector<Real> shocks(static_cast<std::size_t>(draws));
+    if constexpr (std::is_same_v<Real, float>) {
+        FloatNormalStream{params.random_seed, block}.fill(shocks.data(), shocks.size());
+    } else {
+        NormalStream normals{params.random_seed, block};
+        for (double &shock: shocks) {
+            shock = normals.next();
+        }
+    }
 
-    return FinancialMath::simulateGeometricBrownianMotion(market.spot_price, drift, vol_term);
+    if (params.moment_matching && draws > 1) {
+        RunningStatistics moments;
+        for (const Real shock: shocks) {
+            moments.add(shock);
+        }
+        const double mean = params.antithetic ? 0.0 : moments.mean();
+        const double scale = 1.0 / std::sqrt(moments.variance());
+        for (Real &shock: shocks) {
+            shock = static_cast<Real>((shock - mean) * scale);
+        }
+    }
+    return shocks;
 }
 
+namespace {
+    template<typename Kernel>
+    decltype(auto) withControl(const ControlVariate control, Kernel &&kernel) {
+        switch (control) {
+            case ControlVariate::TerminalSpot:
+                return kernel(std::integral_constant<ControlVariate, ControlVariate::TerminalSpot>{});
+            case ControlVariate::BlackScholes:
+                return kernel(std::integral_constant<ControlVariate, ControlVariate::BlackScholes>{});
+            default:
+                return kernel(std::integral_constant<ControlVariate, ControlVariate::None>{});
+        }
+    }
 
-MonteCarloEngine::MonteCarloEngine(const SimulationParameters &parameters)
-    : simulation_parameters_{parameters}, generator_{parameters.random_seed}, distribution_{0.0, 1.0} {}
+    // Minimum gap between the option's strike and the BlackScholes control's, as a fraction of the forward
+    constexpr double control_strike_gap = 0.05;
+
+    // Strike of the BlackScholes control: the forward S_0 e^{rT}, or the option's strike moved
+    // control_strike_gap of the forward away when the option sits closer to the forward than that,
+    // so the control never coincides with the priced payoff
+    double controlStrike(const Option &option, const MarketParameters &market) {
+        const double forward = market.spot_price * std::exp(market.risk_free_rate * option.getExpiry());
+        const double gap = control_strike_gap * forward;
+        const double strike = option.getStrike();
+        if (std::abs(strike - forward) >= gap) return forward;
+        return strike <= forward ? strike + gap : strike - gap;
+    }
+
+    // Shocks per terminal-spot chunk, one FloatVec
+    constexpr std::size_t path_chunk = Simd::FloatVec::width;
+
+    // S_T = S_0 exp(drift + sigma sqrt(T) Z), drift = (r - sigma^2 / 2) T
+    struct PathTerms {
+        double spot;
+        double drift;
+        double vol_sqrt_expiry;
+
+        PathTerms(const MarketParameters &market, const double expiry)
+            : spot{market.spot_price},
+              drift{FinancialMath::calculateDriftTerm(market.risk_free_rate, market.volatility, expiry)},
+              vol_sqrt_expiry{market.volatility * std::sqrt(expiry)} {}
+    };
+
+    // Terminal spots of count <= path_chunk shocks, sign = -1 for the antithetic leg
+    void terminalSpots(const double *shocks, const std::size_t count, const double sign, const PathTerms &terms, double *out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = FinancialMath::simulateGeometricBrownianMotion(terms.spot, terms.drift, terms.vol_sqrt_expiry * (sign * shocks[i]));
+        }
+    }
+
+    void terminalSpots(const float *shocks, const std::size_t count, const double sign, const PathTerms &terms, float *out) {
+        using Simd::FloatVec;
+        const FloatVec shock = Simd::loadPartial<FloatVec>(shocks, count, 0.0f);
+        const FloatVec log_return = Simd::fma(static_cast<float>(sign * terms.vol_sqrt_expiry), shock, static_cast<float>(terms.drift));
+        Simd::storePartial(static_cast<float>(terms.spot) * Simd::exp(log_return), out, count);
+    }
+
+    /**
+     * One block's payoffs, control values and pathwise weights for a fixed precision, option type,
+     * Greek flag, antithetic flag and control variate
+     * - The per-path loop has no type, flag or control branches left; shocks and terminal spots
+     *   are Real, computed a chunk at a time, payoffs and every accumulator double
+     */
+    template<typename Real, Option::Type Type, bool ComputeGreeks, bool Antithetic, ControlVariate Control>
+    SimulationStatistics simulateBlockKernel(
+        const std::vector<Real> &shocks,
+        const MarketParameters &market,
+        const double strike,
+        const double expiry,
+        const double control_strike
+    ) {
+        constexpr double omega = PricingKernels::omega<Type>;
+        const PathTerms terms{market, expiry};
+        const double volatility = market.volatility;
+        const double sqrt_expiry = std::sqrt(expiry);
+        const double gamma_scale = 1.0 / (volatility * sqrt_expiry);
+        const double time_drift = market.risk_free_rate - 0.5 * volatility * volatility;
+        const double time_scale = 0.5 * volatility / sqrt_expiry;
+
+        SimulationStatistics stats;
+
+        // One leg: payoff into the plain statistics, pathwise weights into the Greek sums
+        const auto simulate = [&](const double shock, const double final_spot) {
+            const double payoff = PricingKernels::payoff<Type>(final_spot, strike);
+            stats.paths.add(payoff);
+
+            if constexpr (ComputeGreeks) {
+                if (omega * (final_spot - strike) > 0) {
+                    const double weight = omega * final_spot;
+                    stats.itm_spot += weight;
+                    stats.gamma_weight += weight * (shock * gamma_scale - 1.0);
+                    stats.vega_weight += weight * (sqrt_expiry * shock - volatility * expiry);
+                    stats.time_weight += weight * (time_drift + time_scale * shock);
+                }
+            }
+            return payoff;
+        };
+
+        const auto control = [control_strike](const double final_spot) {
+            if constexpr (Control == ControlVariate::TerminalSpot) {
+                return final_spot;
+            } else if constexpr (Control == ControlVariate::BlackScholes) {
+                return PricingKernels::payoff<Type>(final_spot, control_strike);
+            } else {
+                return 0.0;
+            }
+        };
+
+        Real spots[path_chunk];
+        Real mirrored_spots[path_chunk];
+        for (std::size_t offset = 0; offset < shocks.size(); offset += path_chunk) {
+            const std::size_t count = std::min(path_chunk, shocks.size() - offset);
+            terminalSpots(shocks.data() + offset, count, 1.0, terms, spots);
+            if constexpr (Antithetic) terminalSpots(shocks.data() + offset, count, -1.0, terms, mirrored_spots);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const double shock = shocks[offset + i];
+                const double final_spot = spots[i];
+                double payoff = simulate(shock, final_spot);
+                double control_value = control(final_spot);
+
+                if constexpr (Antithetic) {
+                    const double mirrored_spot = mirrored_spots[i];
+                    const double mirrored_payoff = simulate(-shock, mirrored_spot);
+
+                    control_value = 0.5 * (control_value + control(mirrored_spot));
+                    payoff = 0.5 * (payoff + mirrored_payoff);
+                }
+
+                stats.units.add(payoff, control_value);
+            }
+        }
+        return stats;
+    }
+
+    // Undiscounted payoff sum of one scenario over a block's shocks
+    template<typename Real, Option::Type Type, bool Antithetic>
+    double scenarioPayoffSum(
+        const std::vector<Real> &shocks,
+        const MarketParameters &market,
+        const double strike,
+        const double expiry
+    ) {
+        const PathTerms terms{market, expiry};
+
+        Real spots[path_chunk];
+        Real mirrored_spots[path_chunk];
+        double sum = 0.0;
+        for (std::size_t offset = 0; offset < shocks.size(); offset += path_chunk) {
+            const std::size_t count = std::min(path_chunk, shocks.size() - offset);
+            terminalSpots(shocks.data() + offset, count, 1.0, terms, spots);
+            if constexpr (Antithetic) terminalSpots(shocks.data() + offset, count, -1.0, terms, mirrored_spots);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                sum += PricingKernels::payoff<Type>(spots[i], strike);
+                if constexpr (Antithetic) sum += PricingKernels::payoff<Type>(mirrored_spots[i], strike);
+            }
+        }
+        return sum;
+    }
+}
+
+SimulationStatistics MonteCarloEngine::simulateBlock(
+    const Option &option,
+    const MarketParameters &market_parameters,
+    const std::size_t block
+) const {
+    const SimulationParameters &params = simulation_parameters_;
+    const double control_strike = params.control_variate == ControlVariate::BlackScholes
+                                      ? controlStrike(option, market_parameters)
+                                      : 0.0;
+
+    // One kernel instantiation per block
+    return PricingKernels::withPrecision(params.precision, [&](auto real) {
+        using Real = PricingKernels::Real<real()>;
+        const std::vector<Real> shocks = generateShocks<Real>(block);
+
+        PRICING_SCOPE(Probe::MonteCarloPayoff);
+        return PricingKernels::withType(option.getType(), [&](auto type) {
+            return PricingKernels::withFlag(params.compute_greeks, [&](auto greeks) {
+                return PricingKernels::withFlag(params.antithetic, [&](auto antithetic) {
+                    return withControl(params.control_variate, [&](auto control) {
+                        return simulateBlockKernel<Real, type(), greeks(), antithetic(), control()>(
+                            shocks, market_parameters, option.getStrike(), option.getExpiry(), control_strike
+                        );
+                    });
+                });
+            });
+        });
+    });
+}
+
+std::int64_t MonteCarloEngine::simulateScenarioBlock(
+    const std::vector<Option> &options,
+    const std::vector<MarketParameters> &markets,
+    const std::size_t block,
+    std::vector<double> &sums
+) const {
+    const bool antithetic = simulation_parameters_.antithetic;
+
+    const std::size_t draws = PricingKernels::withPrecision(simulation_parameters_.precision, [&](auto real) {
+        using Real = PricingKernels::Real<real()>;
+        const std::vector<Real> shocks = generateShocks<Real>(block);
+
+        PRICING_SCOPE(Probe::MonteCarloPayoff);
+        for (std::size_t s = 0; s < options.size(); ++s) {
+            const Option &option = options[s];
+            sums[s] += PricingKernels::withType(option.getType(), [&](auto type) {
+                return PricingKernels::withFlag(antithetic, [&](auto mirrored) {
+                    return scenarioPayoffSum<Real, type(), mirrored()>(
+                        shocks, markets[s], option.getStrike(), option.getExpiry()
+                    );
+                });
+            });
+        }
+        return shocks.size();
+    });
+
+    const auto paths = static_cast<std::int64_t>(draws);
+    return antithetic ? 2 * paths : paths;
+}
+
+MonteCarloEngine::Estimate MonteCarloEngine::estimate(const SimulationStatistics &stats, const double control_mean) const {
+    const RunningCovariance &units = stats.units;
+
+    double mean = units.meanX();
+    double unit_variance = units.varianceX();
+
+    if (simulation_parameters_.control_variate != ControlVariate::None && units.varianceY() > 0) {
+        const double beta = units.covariance() / units.varianceY();
+        mean -= beta * (units.meanY() - control_mean);
+        unit_variance = std::max(unit_variance - beta * units.covariance(), 0.0);
+    }
+
+    const auto unit_count = static_cast<double>(units.count());
+    const double paths_per_unit = static_cast<double>(stats.paths.count()) / unit_count;
+    const double factor = unit_variance > 0
+                              ? stats.paths.variance() / (paths_per_unit * unit_variance)
+                              : std::numeric_limits<double>::infinity();
+
+    return Estimate{mean, std::sqrt(unit_variance / unit_count), factor};
+}
+
+Greeks MonteCarloEngine::pathwiseGreeks(
+    const SimulationStatistics &stats,
+    const MarketParameters &market_parameters,
+    const double expiry
+) {
+    const double spot = market_parameters.spot_price;
+    const double rate = market_parameters.risk_free_rate;
+    const double discount = std::exp(-rate * expiry);
+    const double scale = discount / static_cast<double>(stats.paths.count());
+    const double mean_payoff = stats.paths.mean();
+
+    Greeks greeks;
+    greeks.delta = scale * stats.itm_spot / spot;
+    greeks.gamma = scale * stats.gamma_weight / (spot * spot);
+    greeks.vega = scale * stats.vega_weight / 100.0;
+
+    // dV/dT = -r V + e^{-rT} E[omega 1{ITM} dS_T/dT], theta is its negative per day
+    greeks.theta = (rate * discount * mean_payoff - scale * stats.time_weight) / 365.0;
+
+    // dV/dr = -T V + e^{-rT} E[omega 1{ITM} T S_T]
+    greeks.rho = expiry * (scale * stats.itm_spot - discount * mean_payoff) / 100.0;
+    return greeks;
+}
 
 PricingResult MonteCarloEngine::price(
     const Option &option,
     const MarketParameters &market_parameters
 ) const {
+    PRICING_SCOPE(Probe::MonteCarloPrice);
+
     const double rate = market_parameters.risk_free_rate;
-    const int n = simulation_parameters_.num_paths;
     const double time = option.getExpiry();
+    const double discount = std::exp(-rate * time);
+    const double target_error = simulation_parameters_.target_standard_error;
+    const double time_budget = simulation_parameters_.time_budget_ms;
+
+    const double control_mean = controlMean(option, market_parameters);
+    const std::size_t total_blocks = blockCount();
+
+    // A few blocks per thread per round keeps every worker busy between early-stopping checks
+    const std::size_t round_blocks = thread_pool_ ? 4 * static_cast<std::size_t>(thread_pool_->size()) : 1;
+    std::vector<SimulationStatistics> round_stats(std::min(round_blocks, total_blocks));
+
+    Timer timer;
+    timer.start();
+
+    SimulationStatistics stats;
+    bool finished = false;
+
+    for (std::size_t first_block = 0; first_block < total_blocks && !finished; first_block += round_blocks) {
+        const std::size_t count = std::min(round_blocks, total_blocks - first_block);
+        const auto run_block = [&](const std::size_t k) {
+            round_stats[k] = simulateBlock(option, market_parameters, first_block + k);
+        };
+
+        if (thread_pool_) {
+            thread_pool_->parallelFor(count, run_block);
+        } else {
+            run_block(0);
+        }
+
+        // Fold in block order, checking the target after every block
+        PRICING_SCOPE(Probe::MonteCarloStatistics);
+        for (std::size_t k = 0; k < count; ++k) {
+            stats.merge(round_stats[k]);
+            if (target_error > 0 && stats.units.count() > 1
+                && discount * estimate(stats, control_mean).standard_error <= target_error) {
+                finished = true;
+                break;
+            }
+        }
+
+        if (time_budget > 0 && timer.elapsedMilliseconds() >= time_budget) {
+            finished = true;
+        }
+    }
+
+    return makeResult(stats, option, market_parameters);
+}
+
+double MonteCarloEngine::controlMean(const Option &option, const MarketParameters &market_parameters) const {
+    const double discount = std::exp(-market_parameters.risk_free_rate * option.getExpiry());
 
-    std::vector<double> payoffs;
-    payoffs.reserve(n);
+    switch (simulation_parameters_.control_variate) {
+        case ControlVariate::TerminalSpot:
+            return market_parameters.spot_price / discount;
+        case ControlVariate::BlackScholes: {
+            const Option control{controlStrike(option, market_parameters), option.getType(), option.getExpiry()};
+            return BlackScholesEngine{}.price(control, market_parameters).price / discount;
+        }
+        default:
+            return 0.0;
+    }
+}
+
+std::size_t MonteCarloEngine::blockCount() const {
+    return (static_cast<std::size_t>(simulation_parameters_.num_paths) + PATHS_PER_BLOCK - 1) / PATHS_PER_BLOCK;
+}
 
-    for (int i = 0; i < n; ++i) {
-        const double final_spot = simulatePath(market_parameters, time);
-        const double payoff = option.payoff(final_spot);
-        payoffs.push_back(payoff);
+SimulationStatistics MonteCarloEngine::simulateBlocks(
+    const Option &option,
+    const MarketParameters &market_parameters,
+    const std::size_t first_block,
+    const std::size_t last_block
+) const {
+    SimulationStatistics stats;
+    for (std::size_t block = first_block; block < last_block; ++block) {
+        stats.merge(simulateBlock(option, market_parameters, block));
     }
+    return stats;
+}
+
+PricingResult MonteCarloEngine::makeResult(
+    const SimulationStatistics &stats,
+    const Option &option,
+    const MarketParameters &market_parameters
+) const {
+    PRICING_SCOPE(Probe::MonteCarloResult);
+
+    const double rate = market_parameters.risk_free_rate;
+    const double time = option.getExpiry();
+
+    const Estimate result = estimate(stats, controlMean(option, market_parameters));
+    const int paths_used = static_cast<int>(stats.paths.count());
+    const double present_price = FinancialMath::discountToPresent(result.mean, rate, time);
+    const double present_error = FinancialMath::discountToPresent(result.standard_error, rate, time);
 
-    // Stats
-    const double sum = std::accumulate(payoffs.begin(), payoffs.end(), 0.0);
-    const double mean = sum / n;
+    PricingResult pricing_result{present_price, present_error, paths_used, "Monte Carlo"};
+    pricing_result.variance_reduction_factor = result.variance_reduction_factor;
+    if (simulation_parameters_.compute_greeks) {
+        pricing_result.greeks = pathwiseGreeks(stats, market_parameters, time);
+    }
+    return pricing_result;
+}
 
-    double variance{0};
-    for (const double payoff: payoffs) {
-        const double difference = mean - payoff;
-        variance += difference * difference;
+std::vector<double> MonteCarloEngine::priceScenarios(
+    const Option &option,
+    const MarketParameters &market_parameters,
+    const std::vector<BumpScenario> &scenarios
+) const {
+    std::vector<Option> options;
+    std::vector<MarketParameters> markets;
+    options.reserve(scenarios.size());
+    markets.reserve(scenarios.size());
+    for (const auto &scenario: scenarios) {
+        options.push_back(scenario.apply(option));
+        markets.push_back(scenario.apply(market_parameters));
     }
-    variance /= (n - 1);
 
-    const double std_error = std::sqrt(variance / n);
+    const std::size_t total_blocks = blockCount();
+    const std::size_t round_blocks = thread_pool_ ? 4 * static_cast<std::size_t>(thread_pool_->size()) : 1;
+
+    std::vector<double> sums(scenarios.size(), 0.0);
+    std::int64_t paths = 0;
+    std::vector<std::vector<double>> round_sums(std::min(round_blocks, total_blocks));
+    std::vector<std::int64_t> round_paths(round_sums.size());
+
+    for (std::size_t first_block = 0; first_block < total_blocks; first_block += round_blocks) {
+        const std::size_t count = std::min(round_blocks, total_blocks - first_block);
+        const auto run_block = [&](const std::size_t k) {
+            round_sums[k].assign(scenarios.size(), 0.0);
+            round_paths[k] = simulateScenarioBlock(options, markets, first_block + k, round_sums[k]);
+        };
 
-    const double present_price = FinancialMath::discountToPresent(mean, rate, time);
-    const double present_error = FinancialMath::discountToPresent(std_error, rate, time);
+        if (thread_pool_) {
+            thread_pool_->parallelFor(count, run_block);
+        } else {
+            run_block(0);
+        }
 
-    return PricingResult{present_price, present_error, n, "Monte Carlo"};
+        // Block order keeps the sums independent of the thread count
+        for (std::size_t k = 0; k < count; ++k) {
+            paths += round_paths[k];
+            for (std::size_t s = 0; s < sums.size(); ++s) {
+                sums[s] += round_sums[k][s];
+            }
+        }
+    }
+
+    std::vector<double> prices(scenarios.size());
+    for (std::size_t s = 0; s < prices.size(); ++s) {
+        const double mean_payoff = sums[s] / static_cast<double>(paths);
+        prices[s] = FinancialMath::discountToPresent(mean_payoff, markets[s].risk_free_rate, options[s].getExpiry());
+    }
+    return prices;
 }
 
 std::string MonteCarloEngine::getName() const {
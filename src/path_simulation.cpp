@@ -0,0 +1,247 @@
+#include "path_simulation.h"
+#include "financial_math.h"
+#include "philox.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+    using Simd::DoubleVec;
+    using Style = PathDependentOption::Style;
+
+    constexpr int lanes = DoubleVec::width;
+    constexpr int tile_vectors = PathSimulationEngine::TILE_VECTORS;
+    constexpr int tile_paths = PathSimulationEngine::TILE_PATHS;
+
+    // Per-step constants, everything in x = ln(S / S_0)
+    struct StepConstants {
+        double drift;           // (r - sigma^2 / 2) dt
+        double diffusion;       // sigma sqrt(dt)
+        double log_barrier;     // ln(H / S_0)
+        double crossing_scale;  // 2 / (sigma^2 dt)
+        double strike_ratio;    // K / S_0
+        double omega;           // +1 call, -1 put
+        int steps;
+    };
+
+    constexpr bool isUpBarrier(const Style style) { return style == Style::UpAndOut || style == Style::UpAndIn; }
+    constexpr bool isDownBarrier(const Style style) { return style == Style::DownAndOut || style == Style::DownAndIn; }
+    constexpr bool isKnockIn(const Style style) { return style == Style::UpAndIn || style == Style::DownAndIn; }
+
+    /**
+     * Payoffs / S_0 of one tile from its time-major shocks, shocks[step * tile_paths + path]
+     * - Every running quantity is a DoubleVec per vector of the tile, so the loops over
+     *   tile_vectors unroll and the state stays in registers across all steps
+     */
+    template<Style S>
+    void simulateTile(const StepConstants &c, const double *shocks, double *payoffs) {
+        constexpr bool barrier = isUpBarrier(S) || isDownBarrier(S);
+
+        DoubleVec x[tile_vectors];
+        DoubleVec running[tile_vectors];     // sum of S / S_0 or of x, unused otherwise
+        DoubleVec survival[tile_vectors];    // probability the continuous path has not touched the barrier
+
+        // Signed distance to the barrier, positive on the alive side
+        const auto distance = [&](const DoubleVec value) {
+            if constexpr (isUpBarrier(S)) return c.log_barrier - value;
+            else return value - c.log_barrier;
+        };
+
+        for (int v = 0; v < tile_vectors; ++v) {
+            x[v] = 0.0;
+            running[v] = 0.0;
+            survival[v] = barrier ? Simd::select(distance(x[v]) > 0.0, 1.0, 0.0) : DoubleVec{1.0};
+        }
+
+        for (int step = 0; step < c.steps; ++step) {
+            const double *step_shocks = shocks + static_cast<std::size_t>(step) * tile_paths;
+
+            for (int v = 0; v < tile_vectors; ++v) {
+                const DoubleVec next = Simd::fma(c.diffusion, DoubleVec::load(step_shocks + v * lanes), x[v] + c.drift);
+
+                if constexpr (S == Style::ArithmeticAsian) {
+                    running[v] = running[v] + Simd::exp(next);
+                } else if constexpr (S == Style::GeometricAsian) {
+                    running[v] = running[v] + next;
+                } else if constexpr (barrier) {
+                    // Bridge crossing probability exp(-2 d_i d_{i+1} / (sigma^2 dt)), 1 once d_{i+1} <= 0
+                    const DoubleVec d_before = distance(x[v]);
+                    const DoubleVec d_after = distance(next);
+                    const DoubleVec exponent = Simd::max(c.crossing_scale * d_before * d_after, 0.0);
+                    const DoubleVec stay = Simd::select(d_after > 0.0, 1.0 - Simd::exp(-exponent), 0.0);
+                    survival[v] = survival[v] * stay;
+                }
+                x[v] = next;
+            }
+        }
+
+        const double inv_steps = 1.0 / c.steps;
+        for (int v = 0; v < tile_vectors; ++v) {
+            DoubleVec underlying;
+            if constexpr (S == Style::ArithmeticAsian) {
+                underlying = running[v] * inv_steps;
+            } else if constexpr (S == Style::GeometricAsian) {
+                underlying = Simd::exp(running[v] * inv_steps);
+            } else {
+                underlying = Simd::exp(x[v]);
+            }
+
+            DoubleVec payoff = Simd::max(c.omega * (underlying - c.strike_ratio), 0.0);
+            if constexpr (barrier) {
+                payoff = payoff * (isKnockIn(S) ? 1.0 - survival[v] : survival[v]);
+            }
+            payoff.store(payoffs + v * lanes);
+        }
+    }
+
+    template<Style S>
+    void simulateTiles(
+        const StepConstants &c,
+        NormalStream &normals,
+        std::vector<double> &shocks,
+        const int paths,
+        RunningStatistics &stats
+    ) {
+        double payoffs[tile_paths];
+
+        for (int first = 0; first < paths; first += tile_paths) {
+            // Time-major: all tile paths for step 1, then step 2, ...
+            for (double &shock: shocks) {
+                shock = normals.next();
+            }
+            simulateTile<S>(c, shocks.data(), payoffs);
+
+            const int count = std::min(tile_paths, paths - first);
+            for (int path = 0; path < count; ++path) {
+                stats.add(payoffs[path]);
+            }
+        }
+    }
+}
+
+PathSimulationEngine::PathSimulationEngine(const PathSimulationParameters &parameters)
+    : parameters_{parameters} {
+    parameters_.validate();
+
+    const unsigned int threads = parameters.num_threads == 0 ? ThreadPool::hardwareThreads() : parameters.num_threads;
+    if (threads > 1) {
+        thread_pool_ = std::make_shared<ThreadPool>(threads);
+    }
+}
+
+RunningStatistics PathSimulationEngine::simulateBlock(
+    const PathDependentOption &option,
+    const MarketParameters &market_parameters,
+    const std::size_t block
+) const {
+    const Option &vanilla = option.getVanilla();
+    const double dt = vanilla.getExpiry() / parameters_.num_steps;
+    const double volatility = market_parameters.volatility;
+    const double spot = market_parameters.spot_price;
+
+    StepConstants constants{};
+    constants.drift = FinancialMath::calculateDriftTerm(market_parameters.risk_free_rate, volatility, dt);
+    constants.diffusion = volatility * std::sqrt(dt);
+    constants.log_barrier = option.isBarrier() ? std::log(option.getBarrier() / spot) : 0.0;
+    constants.crossing_scale = 2.0 / (volatility * volatility * dt);
+    constants.strike_ratio = vanilla.getStrike() / spot;
+    constants.omega = vanilla.getType() == Option::Type::CALL ? 1.0 : -1.0;
+    constants.steps = parameters_.num_steps;
+
+    const std::int64_t first = static_cast<std::int64_t>(block) * PATHS_PER_BLOCK;
+    const int paths = static_cast<int>(std::min<std::int64_t>(PATHS_PER_BLOCK, parameters_.num_paths - first));
+
+    NormalStream normals{parameters_.random_seed, block};
+    std::vector<double> shocks(static_cast<std::size_t>(parameters_.num_steps) * TILE_PATHS);
+    RunningStatistics stats;
+
+    switch (option.getStyle()) {
+        case Style::European: simulateTiles<Style::European>(constants, normals, shocks, paths, stats); break;
+        case Style::ArithmeticAsian: simulateTiles<Style::ArithmeticAsian>(constants, normals, shocks, paths, stats); break;
+        case Style::GeometricAsian: simulateTiles<Style::GeometricAsian>(constants, normals, shocks, paths, stats); break;
+        case Style::UpAndOut: simulateTiles<Style::UpAndOut>(constants, normals, shocks, paths, stats); break;
+        case Style::UpAndIn: simulateTiles<Style::UpAndIn>(constants, normals, shocks, paths, stats); break;
+        case Style::DownAndOut: simulateTiles<Style::DownAndOut>(constants, normals, shocks, paths, stats); break;
+        case Style::DownAndIn: simulateTiles<Style::DownAndIn>(constants, normals, shocks, paths, stats); break;
+    }
+    return stats;
+}
+
+PricingResult PathSimulationEngine::price(
+    const PathDependentOption &option,
+    const MarketParameters &market_parameters
+) const {
+    market_parameters.validate();
+    option.validate();
+
+    const std::size_t total_blocks =
+        (static_cast<std::size_t>(parameters_.num_paths) + PATHS_PER_BLOCK - 1) / PATHS_PER_BLOCK;
+    std::vector<RunningStatistics> block_stats(total_blocks);
+
+    const auto run_block = [&](const std::size_t block) {
+        block_stats[block] = simulateBlock(option, market_parameters, block);
+    };
+
+    if (thread_pool_) {
+        thread_pool_->parallelFor(total_blocks, run_block);
+    } else {
+        for (std::size_t block = 0; block < total_blocks; ++block) {
+            run_block(block);
+        }
+    }
+
+    RunningStatistics stats;
+    for (const RunningStatistics &block: block_stats) {
+        stats.merge(block);
+    }
+
+    // Payoffs were simulated per unit of spot
+    const double scale = market_parameters.spot_price
+                         * std::exp(-market_parameters.risk_free_rate * option.getVanilla().getExpiry());
+    return PricingResult{
+        scale * stats.mean(),
+        scale * stats.standardError(),
+        static_cast<int>(stats.count()),
+        "Path Monte Carlo"
+    };
+}
+
+PricingResult PathSimulationEngine::price(const Option &option, const MarketParameters &market_parameters) const {
+    return price(PathDependentOption{option, PathDependentOption::Style::European}, market_parameters);
+}
+
+std::string PathSimulationEngine::getName() const {
+    return "Path Monte Carlo (" + std::to_string(parameters_.num_paths) + " paths, "
+           + std::to_string(parameters_.num_steps) + " steps)";
+}
+
+double PathSimulationEngine::geometricAsianPrice(
+    const Option &option,
+    const MarketParameters &market_parameters,
+    const int num_fixings
+) {
+    if (num_fixings <= 0) throw std::invalid_argument("Number of fixings must be positive");
+    market_parameters.validate();
+
+    // ln G is normal: fixings at t_i = i T / N give mean and variance of the average of ln S_{t_i}
+    const double expiry = option.getExpiry();
+    const double rate = market_parameters.risk_free_rate;
+    const double volatility = market_parameters.volatility;
+    const auto n = static_cast<double>(num_fixings);
+    const double dt = expiry / n;
+
+    const double mean = std::log(market_parameters.spot_price) + (rate - 0.5 * volatility * volatility) * dt * (n + 1.0) / 2.0;
+    const double variance = volatility * volatility * dt * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n);
+    const double deviation = std::sqrt(variance);
+
+    const double strike = option.getStrike();
+    const double d2 = (mean - std::log(strike)) / deviation;
+    const double d1 = d2 + deviation;
+    const double forward = std::exp(mean + 0.5 * variance);
+    const double discount = std::exp(-rate * expiry);
+
+    if (option.getType() == Option::Type::CALL) {
+        return discount * (forward * FinancialMath::normalCDF(d1) - strike * FinancialMath::normalCDF(d2));
+    }
+    return discount * (strike * FinancialMath::normalCDF(-d2) - forward * FinancialMath::normalCDF(-d1));
+}
@@ -0,0 +1,296 @@
+#include "pde.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace {
+    constexpr double days_per_year = 365.0;
+
+    // Row of the spatial operator L: coefficients of v_{i-1}, v_i, v_{i+1}
+    struct OperatorRow {
+        double lower;
+        double diagonal;
+        double upper;
+    };
+
+    // Row of the LU factors of I - s L: sub-diagonal, 1 / pivot, super-diagonal / pivot
+    struct FactorRow {
+        double lower;
+        double inv_pivot;
+        double upper_ratio;
+    };
+
+    struct Workspace {
+        std::vector<double> grid;
+        std::vector<double> payoff;
+        std::vector<OperatorRow> rows;
+        std::vector<FactorRow> factors;
+        std::vector<double> current;
+        std::vector<double> previous;
+        std::vector<double> rhs;
+        double factored_weight{-1.0};   // s of the stored factors
+    };
+
+    thread_local Workspace workspace;
+
+    // Nodes 1 + c sinh(xi) on [0, upper] with xi uniform, end points exact
+    void buildGrid(std::vector<double> &grid, const int steps, const double upper, const double concentration) {
+        const double xi_low = std::asinh(-1.0 / concentration);
+        const double xi_high = std::asinh((upper - 1.0) / concentration);
+
+        grid.resize(static_cast<std::size_t>(steps) + 1);
+        for (int i = 0; i <= steps; ++i) {
+            const double xi = xi_low + (xi_high - xi_low) * i / steps;
+            grid[i] = 1.0 + concentration * std::sinh(xi);
+        }
+        grid[0] = 0.0;
+        grid[steps] = upper;
+    }
+
+    // 0.5 sigma^2 m^2 v_mm + r m v_m - r v with three-point differences on the non-uniform grid
+    void buildOperator(const std::vector<double> &grid, const double rate, const double volatility, std::vector<OperatorRow> &rows) {
+        const std::size_t last = grid.size() - 1;
+        rows.resize(last);
+
+        // At m = 0 diffusion and drift vanish, v_tau = -r v
+        rows[0] = {0.0, -rate, 0.0};
+        for (std::size_t i = 1; i < last; ++i) {
+            const double m = grid[i];
+            const double h_down = m - grid[i - 1];
+            const double h_up = grid[i + 1] - m;
+            const double h_sum = h_down + h_up;
+
+            const double diffusion = 0.5 * volatility * volatility * m * m;
+            const double drift = rate * m;
+
+            rows[i].lower = diffusion * 2.0 / (h_down * h_sum) - drift * h_up / (h_down * h_sum);
+            rows[i].diagonal = -diffusion * 2.0 / (h_down * h_up) + drift * (h_up - h_down) / (h_down * h_up) - rate;
+            rows[i].upper = diffusion * 2.0 / (h_up * h_sum) + drift * h_down / (h_up * h_sum);
+        }
+    }
+
+    void factorize(const std::vector<OperatorRow> &rows, const double weight, std::vector<FactorRow> &factors) {
+        factors.resize(rows.size());
+
+        double previous_ratio = 0.0;
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            const double lower = -weight * rows[i].lower;
+            const double inv_pivot = 1.0 / (1.0 - weight * rows[i].diagonal - lower * previous_ratio);
+            previous_ratio = -weight * rows[i].upper * inv_pivot;
+            factors[i] = {lower, inv_pivot, previous_ratio};
+        }
+    }
+
+    /**
+     * One theta-scheme step: (I - s L) v_new = (I + e L) v_old, boundary value at the top node
+     * - s = e = dt / 2 is Crank-Nicolson with step dt, s = dt / 2 and e = 0 an implicit half step,
+     *   so both share the same factors
+     * - previous receives v_old
+     */
+    void advance(Workspace &ws, const double implicit_weight, const double explicit_weight, const double boundary) {
+        if (implicit_weight != ws.factored_weight) {
+            factorize(ws.rows, implicit_weight, ws.factors);
+            ws.factored_weight = implicit_weight;
+        }
+
+        ws.previous.swap(ws.current);
+        const std::vector<double> &old_values = ws.previous;
+        std::vector<double> &values = ws.current;
+        const std::size_t last = ws.rows.size();
+
+        ws.rhs[0] = old_values[0] + explicit_weight * ws.rows[0].diagonal * old_values[0];
+        for (std::size_t i = 1; i < last; ++i) {
+            const OperatorRow &row = ws.rows[i];
+            ws.rhs[i] = old_values[i] + explicit_weight
+                        * (row.lower * old_values[i - 1] + row.diagonal * old_values[i] + row.upper * old_values[i + 1]);
+        }
+
+        // Forward elimination in place, then back substitution
+        double y = 0.0;
+        for (std::size_t i = 0; i < last; ++i) {
+            const FactorRow &factor = ws.factors[i];
+            y = (ws.rhs[i] - factor.lower * y) * factor.inv_pivot;
+            ws.rhs[i] = y;
+        }
+
+        // The last row's upper_ratio carries the implicit boundary term, so it stays out of rhs
+        values[last] = boundary;
+        for (std::size_t i = last; i-- > 0;) {
+            values[i] = ws.rhs[i] - ws.factors[i].upper_ratio * values[i + 1];
+        }
+    }
+
+    void project(Workspace &ws) {
+        for (std::size_t i = 0; i < ws.current.size(); ++i) {
+            ws.current[i] = std::max(ws.current[i], ws.payoff[i]);
+        }
+    }
+
+    // Value, slope and curvature of the quadratic through the three nodes nearest m
+    struct Interpolation {
+        std::size_t first;
+        double value[3];
+        double slope[3];
+        double curvature[3];
+
+        Interpolation(const std::vector<double> &grid, const double m) {
+            const auto above = std::upper_bound(grid.begin(), grid.end(), m);
+            std::size_t nearest = static_cast<std::size_t>(above - grid.begin());
+            if (nearest == grid.size() || (nearest > 0 && m - grid[nearest - 1] < grid[nearest] - m)) {
+                --nearest;
+            }
+            first = std::clamp<std::size_t>(nearest, 1, grid.size() - 2) - 1;
+
+            const double x[3] = {grid[first], grid[first + 1], grid[first + 2]};
+            for (int k = 0; k < 3; ++k) {
+                const double a = x[(k + 1) % 3];
+                const double b = x[(k + 2) % 3];
+                const double denominator = (x[k] - a) * (x[k] - b);
+                value[k] = (m - a) * (m - b) / denominator;
+                slope[k] = ((m - a) + (m - b)) / denominator;
+                curvature[k] = 2.0 / denominator;
+            }
+        }
+
+        [[nodiscard]] static double apply(const double (&weights)[3], const std::vector<double> &values, const std::size_t first) {
+            return weights[0] * values[first] + weights[1] * values[first + 1] + weights[2] * values[first + 2];
+        }
+    };
+}
+
+PdeEngine::PdeEngine(const PdeParameters &parameters)
+    : parameters_{parameters} {
+    parameters_.validate();
+}
+
+PricingResult PdeEngine::price(const Option &option, const MarketParameters &market_parameters) const {
+    const double strike = option.getStrike();
+    const double expiry = option.getExpiry();
+
+    double price;
+    double delta;
+    double gamma;
+    double theta;
+    priceGrid(option.getType(), &strike, 1, &expiry, 1, market_parameters,
+              BatchResults{&price, &delta, &gamma, nullptr, &theta, nullptr});
+
+    Greeks greeks;
+    greeks.delta = delta;
+    greeks.gamma = gamma;
+    greeks.theta = theta;
+    return PricingResult{price, greeks, getName()};
+}
+
+void PdeEngine::priceStrikes(
+    const Option::Type type,
+    const double expiry,
+    const double *strikes,
+    const std::size_t num_strikes,
+    const MarketParameters &market_parameters,
+    const BatchResults &results
+) const {
+    priceGrid(type, strikes, num_strikes, &expiry, 1, market_parameters, results);
+}
+
+void PdeEngine::priceGrid(
+    const Option::Type type,
+    const double *strikes,
+    const std::size_t num_strikes,
+    const double *expiries,
+    const std::size_t num_expiries,
+    const MarketParameters &market_parameters,
+    const BatchResults &results
+) const {
+    market_parameters.validate();
+    if (num_strikes == 0 || num_expiries == 0) return;
+
+    const double min_strike = *std::min_element(strikes, strikes + num_strikes);
+    const double max_expiry = *std::max_element(expiries, expiries + num_expiries);
+    const double min_expiry = *std::min_element(expiries, expiries + num_expiries);
+    if (!(min_strike > 0)) throw std::invalid_argument("Strikes must be positive");
+    if (!(min_expiry > 0)) throw std::invalid_argument("Expiries must be positive");
+
+    const double spot = market_parameters.spot_price;
+    const double rate = market_parameters.risk_free_rate;
+    const double volatility = market_parameters.volatility;
+    const bool call = type == Option::Type::CALL;
+    const int space_steps = parameters_.num_space_steps;
+
+    // Grid reaches grid_std_devs above the largest moneyness at the longest expiry
+    const double upper = std::max(spot / min_strike, 1.0)
+                         * std::exp(parameters_.grid_std_devs * volatility * std::sqrt(max_expiry) + std::abs(rate) * max_expiry);
+
+    Workspace &ws = workspace;
+    buildGrid(ws.grid, space_steps, upper, parameters_.grid_concentration);
+    buildOperator(ws.grid, rate, volatility, ws.rows);
+    ws.factored_weight = -1.0;
+
+    const std::size_t nodes = ws.grid.size();
+    ws.payoff.resize(nodes);
+    ws.current.resize(nodes);
+    ws.previous.resize(nodes);
+    ws.rhs.resize(nodes - 1);
+    for (std::size_t i = 0; i < nodes; ++i) {
+        ws.payoff[i] = std::max(call ? ws.grid[i] - 1.0 : 1.0 - ws.grid[i], 0.0);
+    }
+    std::copy(ws.payoff.begin(), ws.payoff.end(), ws.current.begin());
+
+    // Far-field value at the top node: the forward intrinsic for calls, zero for puts
+    const auto boundary = [&](const double tau) { return call ? upper - std::exp(-rate * tau) : 0.0; };
+    const bool american = parameters_.exercise == ExerciseStyle::American;
+
+    std::vector<std::size_t> order(num_expiries);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const std::size_t a, const std::size_t b) { return expiries[a] < expiries[b]; });
+
+    double tau = 0.0;
+    double layer_gap = 0.0;
+    int steps_taken = 0;
+
+    for (const std::size_t e: order) {
+        // Steps proportional to the segment length, at least one per distinct expiry
+        const double segment = expiries[e] - tau;
+        if (segment > 0) {
+            const int steps = std::max(1, static_cast<int>(std::lround(parameters_.num_time_steps * segment / max_expiry)));
+            const double dt = segment / steps;
+
+            for (int n = 0; n < steps; ++n, ++steps_taken) {
+                const double half = 0.5 * dt;
+                if (steps_taken < parameters_.rannacher_steps) {
+                    advance(ws, half, 0.0, boundary(tau + half));
+                    if (american) project(ws);
+                    advance(ws, half, 0.0, boundary(tau + dt));
+                    layer_gap = half;
+                } else {
+                    advance(ws, half, half, boundary(tau + dt));
+                    layer_gap = dt;
+                }
+                if (american) project(ws);
+                tau += dt;
+            }
+            tau = expiries[e];
+        }
+
+        for (std::size_t k = 0; k < num_strikes; ++k) {
+            const double strike = strikes[k];
+            const Interpolation weights{ws.grid, spot / strike};
+            const std::size_t out = e * num_strikes + k;
+
+            const double value = Interpolation::apply(weights.value, ws.current, weights.first);
+            results.price[out] = strike * value;
+            if (results.delta) results.delta[out] = Interpolation::apply(weights.slope, ws.current, weights.first);
+            if (results.gamma) results.gamma[out] = Interpolation::apply(weights.curvature, ws.current, weights.first) / strike;
+            if (results.theta) {
+                const double earlier = Interpolation::apply(weights.value, ws.previous, weights.first);
+                results.theta[out] = strike * (earlier - value) / layer_gap / days_per_year;
+            }
+        }
+    }
+}
+
+std::string PdeEngine::getName() const {
+    const char *style = parameters_.exercise == ExerciseStyle::American ? "American" : "European";
+    return "Crank-Nicolson PDE (" + std::to_string(parameters_.num_space_steps) + "x"
+           + std::to_string(parameters_.num_time_steps) + ", " + style + ")";
+}
@@ -0,0 +1,181 @@
+#include "portfolio_pricer.h"
+#include "timer.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+
+namespace {
+    // Completion tracking for one price() call
+    struct RunState {
+        Timer timer;
+        std::vector<std::optional<PricingResult>> results;
+        std::vector<double> latencies;
+
+        std::mutex mutex;
+        std::condition_variable done;
+        std::size_t remaining;
+        std::exception_ptr error;
+
+        explicit RunState(const std::size_t count)
+            : results(count), latencies(count, 0.0), remaining{count} {
+            timer.start();
+        }
+
+        void complete(const std::size_t job, PricingResult result) {
+            results[job] = std::move(result);
+            latencies[job] = timer.elapsed();
+            finish();
+        }
+
+        void fail(const std::exception_ptr exception) {
+            {
+                const std::lock_guard lock{mutex};
+                if (!error) error = exception;
+            }
+            finish();
+        }
+
+        void finish() {
+            const std::lock_guard lock{mutex};
+            if (--remaining == 0) {
+                done.notify_all();
+            }
+        }
+    };
+
+    // Sub-task results of one split Monte Carlo job; owns a copy of the job because sibling
+    // sub-tasks may still run after a failure has already released the caller
+    struct SplitJob {
+        PricingJob job;
+        std::vector<SimulationStatistics> parts;
+        std::atomic<std::size_t> remaining;
+        std::atomic<bool> failed;
+
+        SplitJob(const PricingJob &pricing_job, const std::size_t count)
+            : job{pricing_job}, parts(count), remaining{count}, failed{false} {}
+    };
+
+    double percentile(const std::vector<double> &sorted, const double fraction) {
+        const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+        return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+    }
+}
+
+PortfolioPricer::PortfolioPricer(
+    const unsigned int num_threads,
+    const SimulationParameters &simulation,
+    const QuasiMonteCarloParameters &quasi_monte_carlo
+) {
+    SimulationParameters worker_simulation = simulation;
+    worker_simulation.num_threads = 1;
+
+    pool_ = std::make_unique<WorkStealingPool>(num_threads);
+    for (unsigned int i = 0; i < pool_->size(); ++i) {
+        engines_.push_back(std::make_unique<WorkerEngines>(
+            WorkerEngines{BlackScholesEngine{}, MonteCarloEngine{worker_simulation}, QuasiMonteCarloEngine{quasi_monte_carlo}}
+        ));
+    }
+}
+
+PortfolioReport PortfolioPricer::price(const std::vector<PricingJob> &jobs) const {
+    PortfolioReport report{{}, 0.0, 0.0, 0.0, 0.0, 0.0};
+    if (jobs.empty()) return report;
+
+    RunState state{jobs.size()};
+
+    const SimulationParameters &simulation = engines_.front()->monte_carlo.getSimulationParameters();
+    const bool can_split = simulation.target_standard_error == 0 && simulation.time_budget_ms == 0;
+    const std::size_t total_blocks = engines_.front()->monte_carlo.blockCount();
+
+    for (std::size_t index = 0; index < jobs.size(); ++index) {
+        const PricingJob &job = jobs[index];
+
+        if (job.engine == EngineType::MonteCarlo && can_split && total_blocks > BLOCKS_PER_TASK) {
+            const std::size_t tasks = (total_blocks + BLOCKS_PER_TASK - 1) / BLOCKS_PER_TASK;
+            auto split = std::make_shared<SplitJob>(job, tasks);
+
+            for (std::size_t part = 0; part < tasks; ++part) {
+                pool_->submit([this, &state, index, split, part, total_blocks](const unsigned int worker) {
+                    const PricingJob &split_job = split->job;
+                    const MonteCarloEngine &engine = engines_[worker]->monte_carlo;
+                    try {
+                        const std::size_t first = part * BLOCKS_PER_TASK;
+                        split->parts[part] = engine.simulateBlocks(
+                            split_job.option, split_job.market, first, std::min(first + BLOCKS_PER_TASK, total_blocks)
+                        );
+                    } catch (...) {
+                        if (!split->failed.exchange(true)) {
+                            state.fail(std::current_exception());
+                        }
+                    }
+
+                    // The last sub-task merges in block order and completes the job
+                    if (split->remaining.fetch_sub(1) != 1 || split->failed.load()) return;
+                    try {
+                        SimulationStatistics stats;
+                        for (const auto &part_stats: split->parts) {
+                            stats.merge(part_stats);
+                        }
+                        state.complete(index, engine.makeResult(stats, split_job.option, split_job.market));
+                    } catch (...) {
+                        state.fail(std::current_exception());
+                    }
+                });
+            }
+            continue;
+        }
+
+        const TaskPriority priority = job.engine == EngineType::BlackScholes ? TaskPriority::High : TaskPriority::Normal;
+        pool_->submit([this, &state, &job, index](const unsigned int worker) {
+            const WorkerEngines &engines = *engines_[worker];
+            try {
+                switch (job.engine) {
+                    case EngineType::BlackScholes:
+                        state.complete(index, engines.black_scholes.price(job.option, job.market));
+                        break;
+                    case EngineType::MonteCarlo:
+                        state.complete(index, engines.monte_carlo.price(job.option, job.market));
+                        break;
+                    case EngineType::QuasiMonteCarlo:
+                        state.complete(index, engines.quasi_monte_carlo.price(job.option, job.market));
+                        break;
+                }
+            } catch (...) {
+                state.fail(std::current_exception());
+            }
+        }, priority);
+    }
+
+    {
+        std::unique_lock lock{state.mutex};
+        state.done.wait(lock, [&]() { return state.remaining == 0; });
+    }
+    report.wall_time_microseconds = state.timer.elapsed();
+
+    if (state.error) {
+        std::rethrow_exception(state.error);
+    }
+
+    report.jobs.reserve(jobs.size());
+    for (std::size_t index = 0; index < jobs.size(); ++index) {
+        report.jobs.push_back(JobResult{std::move(*state.results[index]), state.latencies[index]});
+    }
+
+    std::vector<double> sorted = state.latencies;
+    std::sort(sorted.begin(), sorted.end());
+
+    double total = 0.0;
+    for (const double latency: sorted) {
+        total += latency;
+    }
+    report.mean_latency_microseconds = total / static_cast<double>(sorted.size());
+    report.median_latency_microseconds = percentile(sorted, 0.5);
+    report.p99_latency_microseconds = percentile(sorted, 0.99);
+    report.max_latency_microseconds = sorted.back();
+
+    return report;
+}
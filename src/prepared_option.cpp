@@ -0,0 +1,34 @@
+#include "prepared_option.h"
+#include <cmath>
+#include <stdexcept>
+
+PreparedOption::PreparedOption(const Option &option, const double rate, const double volatility)
+    : option_{option} {
+    prepare(rate, volatility);
+}
+
+void PreparedOption::prepare(const double rate, const double volatility) {
+    // Validated before any member changes, so a rejected bind() leaves the bound terms intact
+    if (volatility <= 0) throw std::invalid_argument("Volatility price must be positive");
+    if (option_.getExpiry() <= 0) throw std::invalid_argument("Expiry must be positive");
+
+    rate_ = rate;
+    volatility_ = volatility;
+
+    const double expiry = option_.getExpiry();
+    omega_ = option_.getType() == Option::Type::CALL ? 1.0 : -1.0;
+    log_strike_ = std::log(option_.getStrike());
+    drift_ = (rate_ + 0.5 * volatility_ * volatility_) * expiry;
+    sqrt_expiry_ = std::sqrt(expiry);
+    vol_sqrt_expiry_ = volatility_ * sqrt_expiry_;
+    inv_vol_sqrt_expiry_ = 1.0 / vol_sqrt_expiry_;
+    discounted_strike_ = option_.getStrike() * std::exp(-rate_ * expiry);
+    theta_decay_ = volatility_ / (2.0 * sqrt_expiry_);
+}
+
+bool PreparedOption::bind(const double rate, const double volatility) {
+    if (rate == rate_ && volatility == volatility_) return false;
+
+    prepare(rate, volatility);
+    return true;
+}
@@ -0,0 +1,202 @@
+#include "pricing_client.h"
+#include "timer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <random>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace PricingProtocol;
+
+namespace {
+    // Distinct options each connection cycles through
+    constexpr std::size_t option_pool_requests = 64;
+
+    std::vector<WireOption> generateOptions(const std::size_t count, const unsigned int seed) {
+        std::mt19937_64 generator{seed};
+        std::uniform_real_distribution<double> moneyness{80.0, 120.0};
+        std::uniform_real_distribution<double> rate{0.01, 0.05};
+        std::uniform_real_distribution<double> volatility{0.1, 0.4};
+        std::uniform_real_distribution<double> expiry{0.1, 2.0};
+
+        std::vector<WireOption> options(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            options[i] = WireOption{
+                moneyness(generator), moneyness(generator), rate(generator), volatility(generator), expiry(generator),
+                static_cast<std::uint32_t>(i % 2), 0
+            };
+        }
+        return options;
+    }
+
+    double percentile(const std::vector<double> &sorted, const double fraction) {
+        if (sorted.empty()) return 0.0;
+        const auto rank = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+}
+
+PricingClient::PricingClient(const std::string &socket_path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path is too long: " + socket_path);
+    }
+    std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) throw std::runtime_error(std::string{"Cannot create socket: "} + std::strerror(errno));
+    if (::connect(fd_, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        const std::string reason = std::strerror(errno);
+        ::close(fd_);
+        fd_ = -1;
+        throw std::runtime_error("Cannot connect to " + socket_path + ": " + reason);
+    }
+}
+
+PricingClient::~PricingClient() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+PricingClient::PricingClient(PricingClient &&other) noexcept
+    : fd_{std::exchange(other.fd_, -1)}, next_id_{other.next_id_}, buffer_{std::move(other.buffer_)} {}
+
+PricingClient &PricingClient::operator=(PricingClient &&other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = std::exchange(other.fd_, -1);
+        next_id_ = other.next_id_;
+        buffer_ = std::move(other.buffer_);
+    }
+    return *this;
+}
+
+void PricingClient::exchange(const std::uint64_t id) {
+    if (fd_ < 0) throw std::runtime_error("Client is not connected");
+    writeAll(fd_, buffer_.data(), buffer_.size());
+
+    ResponseHeader header{};
+    do {
+        if (!readFrame(fd_, buffer_, sizeof(header) + static_cast<std::size_t>(MAX_REQUEST_OPTIONS) * sizeof(WireResult))) {
+            throw std::runtime_error("Server closed the connection");
+        }
+        if (buffer_.size() < sizeof(header)) throw std::runtime_error("Response shorter than its header");
+        std::memcpy(&header, buffer_.data(), sizeof(header));
+    } while (header.id != id);
+
+    if (header.status != Status::Ok) {
+        throw std::invalid_argument(std::string{reinterpret_cast<const char *>(buffer_.data()) + sizeof(header),
+                                                buffer_.size() - sizeof(header)});
+    }
+}
+
+void PricingClient::price(
+    const WireOption *options,
+    const std::size_t count,
+    const Method method,
+    WireResult *results
+) {
+    if (count > MAX_REQUEST_OPTIONS) throw std::invalid_argument("Too many options for one request");
+
+    const RequestHeader request{RequestType::Price, method, next_id_++, static_cast<std::uint32_t>(count), 0};
+    buffer_.clear();
+    appendFrame(buffer_, {{&request, sizeof(request)}, {options, count * sizeof(WireOption)}});
+    exchange(request.id);
+
+    if (buffer_.size() != sizeof(ResponseHeader) + count * sizeof(WireResult)) {
+        throw std::runtime_error("Response size does not match the request");
+    }
+    if (count > 0) std::memcpy(results, buffer_.data() + sizeof(ResponseHeader), count * sizeof(WireResult));
+}
+
+std::vector<WireResult> PricingClient::price(const std::vector<WireOption> &options, const Method method) {
+    std::vector<WireResult> results(options.size());
+    price(options.data(), options.size(), method, results.data());
+    return results;
+}
+
+WireStatistics PricingClient::statistics() {
+    const RequestHeader request{RequestType::Stats, Method::BlackScholes, next_id_++, 0, 0};
+    buffer_.clear();
+    appendFrame(buffer_, {{&request, sizeof(request)}});
+    exchange(request.id);
+
+    WireStatistics statistics{};
+    if (buffer_.size() != sizeof(ResponseHeader) + sizeof(statistics)) throw std::runtime_error("Malformed statistics response");
+    std::memcpy(&statistics, buffer_.data() + sizeof(ResponseHeader), sizeof(statistics));
+    return statistics;
+}
+
+LoadGenerator::LoadGenerator(LoadTestParameters parameters)
+    : parameters_{std::move(parameters)} {
+    parameters_.validate();
+}
+
+LoadTestReport LoadGenerator::run() const {
+    const LoadTestParameters &params = parameters_;
+    const std::size_t width = params.options_per_request;
+
+    std::vector<PricingClient> clients;
+    clients.reserve(params.connections);
+    for (unsigned int c = 0; c < params.connections; ++c) clients.emplace_back(params.socket_path);
+
+    std::vector<std::vector<double>> latencies(params.connections);
+    std::promise<void> start;
+    const std::shared_future<void> started = start.get_future().share();
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    std::vector<std::thread> threads;
+    for (unsigned int c = 0; c < params.connections; ++c) {
+        threads.emplace_back([&, c] {
+            try {
+                const std::size_t pool_requests = std::min(params.requests, option_pool_requests);
+                const std::vector<WireOption> options = generateOptions(pool_requests * width, params.random_seed + c);
+                std::vector<WireResult> results(width);
+                std::vector<double> &samples = latencies[c];
+                samples.reserve(params.requests);
+                Timer timer;
+
+                started.wait();
+                for (std::size_t r = 0; r < params.requests; ++r) {
+                    timer.start();
+                    clients[c].price(options.data() + (r % pool_requests) * width, width, params.method, results.data());
+                    samples.push_back(timer.elapsed());
+                }
+            } catch (...) {
+                const std::lock_guard lock{error_mutex};
+                if (!error) error = std::current_exception();
+            }
+        });
+    }
+
+    Timer wall_timer;
+    wall_timer.start();
+    start.set_value();
+    for (std::thread &thread: threads) thread.join();
+
+    LoadTestReport report;
+    report.wall_seconds = wall_timer.elapsedSeconds();
+    if (error) std::rethrow_exception(error);
+
+    std::vector<double> all;
+    for (const std::vector<double> &samples: latencies) all.insert(all.end(), samples.begin(), samples.end());
+    std::sort(all.begin(), all.end());
+
+    double sum = 0.0;
+    for (const double sample: all) sum += sample;
+    report.requests = all.size();
+    report.options = all.size() * width;
+    report.mean_us = all.empty() ? 0.0 : sum / static_cast<double>(all.size());
+    report.p50_us = percentile(all, 0.5);
+    report.p99_us = percentile(all, 0.99);
+    report.max_us = all.empty() ? 0.0 : all.back();
+    report.server = clients.front().statistics();
+    return report;
+}
@@ -0,0 +1,78 @@
+#include "pricing_protocol.h"
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace PricingProtocol {
+    bool readExact(const int fd, void *data, const std::size_t bytes) {
+        auto *out = static_cast<unsigned char *>(data);
+        std::size_t done = 0;
+
+        while (done < bytes) {
+            const ssize_t read = ::read(fd, out + done, bytes - done);
+            if (read > 0) {
+                done += static_cast<std::size_t>(read);
+                continue;
+            }
+            if (read < 0 && errno == EINTR) continue;
+            if (read == 0 && done == 0) return false;
+            throw std::runtime_error(read == 0 ? "Connection closed mid-message"
+                                               : std::string{"Socket read failed: "} + std::strerror(errno));
+        }
+        return true;
+    }
+
+    void writeAll(const int fd, const void *data, const std::size_t bytes) {
+        const auto *in = static_cast<const unsigned char *>(data);
+        std::size_t done = 0;
+
+        while (done < bytes) {
+            const ssize_t written = ::send(fd, in + done, bytes - done, MSG_NOSIGNAL);
+            if (written >= 0) {
+                done += static_cast<std::size_t>(written);
+                continue;
+            }
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string{"Socket write failed: "} + std::strerror(errno));
+        }
+    }
+
+    bool readFrame(const int fd, std::vector<unsigned char> &payload, const std::size_t max_bytes) {
+        std::uint32_t length = 0;
+        if (!readExact(fd, &length, sizeof(length))) return false;
+        if (length > max_bytes) throw std::runtime_error("Frame of " + std::to_string(length) + " bytes is too large");
+
+        payload.resize(length);
+        if (length > 0 && !readExact(fd, payload.data(), length)) {
+            throw std::runtime_error("Connection closed mid-message");
+        }
+        return true;
+    }
+
+    void appendFrame(std::vector<unsigned char> &out, const std::initializer_list<std::pair<const void *, std::size_t>> parts) {
+        std::uint32_t length = 0;
+        for (const auto &[data, bytes]: parts) length += static_cast<std::uint32_t>(bytes);
+
+        const std::size_t start = out.size();
+        out.resize(start + sizeof(length) + length);
+        unsigned char *cursor = out.data() + start;
+        std::memcpy(cursor, &length, sizeof(length));
+        cursor += sizeof(length);
+        for (const auto &[data, bytes]: parts) {
+            if (bytes > 0) std::memcpy(cursor, data, bytes);
+            cursor += bytes;
+        }
+    }
+
+    std::string validate(const WireOption &option) {
+        if (option.type > 1) return "type must be 0 (call) or 1 (put)";
+        if (!(option.spot > 0 && option.strike > 0 && option.volatility > 0 && option.expiry > 0)) {
+            return "spot, strike, volatility and expiry must be positive";
+        }
+        if (!std::isfinite(option.rate)) return "rate must be finite";
+        return {};
+    }
+}
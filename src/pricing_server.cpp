@@ -0,0 +1,479 @@
+#include "pricing_server.h"
+#include "batch_pricer.h"
+#include "latency_histogram.h"
+#include "option_batch.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace PricingProtocol;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // How often the accept loop checks for stop()
+    constexpr int accept_poll_ms = 100;
+
+    // A client that stops reading is dropped after this long; only its own writer waits
+    constexpr int send_timeout_s = 5;
+
+    /**
+     * One client socket with its reader and writer threads
+     * - Every response (priced, rejected or Stats) goes through the outbox to the writer, the only
+     *   thread writing the socket, so a client that stops reading stalls its own writer and
+     *   nobody else
+     * - The first failed or timed-out write drops the connection; later responses are discarded
+     * - The writer exits once reading has ended and every queued request has been answered
+     */
+    struct Connection {
+        struct Outgoing {
+            std::vector<unsigned char> frame;
+            std::size_t options;            // priced options, 0 for error and Stats frames
+            Clock::time_point received;
+            bool priced;
+        };
+
+        int fd;
+        std::thread reader;
+        std::thread writer;
+        std::atomic<bool> finished{false};  // writer done, so both threads can be joined
+
+        std::mutex outbox_mutex;
+        std::condition_variable outbox_ready;
+        std::deque<Outgoing> outbox;
+        std::size_t pending{0};             // queued requests not answered yet
+        bool reading{true};
+
+        explicit Connection(const int socket) : fd{socket} {}
+        ~Connection() { ::close(fd); }
+
+        Connection(const Connection &) = delete;
+        Connection &operator=(const Connection &) = delete;
+
+        // Before a request is queued for the batcher
+        void expect() {
+            const std::lock_guard lock{outbox_mutex};
+            ++pending;
+        }
+
+        // answers_request: the response settles a request counted by expect()
+        void post(Outgoing response, const bool answers_request) {
+            {
+                const std::lock_guard lock{outbox_mutex};
+                if (answers_request) --pending;
+                outbox.push_back(std::move(response));
+            }
+            outbox_ready.notify_one();
+        }
+
+        void stopReading() {
+            {
+                const std::lock_guard lock{outbox_mutex};
+                reading = false;
+            }
+            outbox_ready.notify_one();
+        }
+
+        // Next response to write, false once nothing more can arrive
+        bool next(Outgoing &response) {
+            std::unique_lock lock{outbox_mutex};
+            outbox_ready.wait(lock, [this] { return !outbox.empty() || (!reading && pending == 0); });
+            if (outbox.empty()) return false;
+
+            response = std::move(outbox.front());
+            outbox.pop_front();
+            return true;
+        }
+    };
+
+    struct PendingRequest {
+        std::shared_ptr<Connection> connection;
+        std::uint64_t id;
+        Method method;
+        std::vector<WireOption> options;
+        Clock::time_point received;
+        std::string error;      // rejected request, answered in its queue position without pricing
+    };
+
+    // Struct-of-arrays scratch for a micro-batch, one contiguous run per method, reused across batches
+    struct Workspace {
+        std::vector<double> spot, strike, rate, volatility, expiry;
+        std::vector<Option::Type> type;
+        std::vector<double> price, standard_error, delta, gamma, vega, theta, rho;
+        std::vector<WireResult> response;
+
+        void resize(const std::size_t size) {
+            for (std::vector<double> *column: {&spot, &strike, &rate, &volatility, &expiry, &price,
+                                               &standard_error, &delta, &gamma, &vega, &theta, &rho}) {
+                column->resize(size);
+            }
+            type.resize(size);
+        }
+
+        [[nodiscard]] OptionBatch book(const std::size_t size) const {
+            return OptionBatch{strike.data(), expiry.data(), type.data(), spot.data(), rate.data(), volatility.data(), size};
+        }
+
+        [[nodiscard]] BatchResults results() {
+            return BatchResults{price.data(), delta.data(), gamma.data(), vega.data(), theta.data(), rho.data()};
+        }
+    };
+
+    std::vector<unsigned char> errorFrame(const std::uint64_t id, const std::string &message) {
+        const ResponseHeader header{id, Status::Error, static_cast<std::uint32_t>(message.size())};
+        std::vector<unsigned char> frame;
+        appendFrame(frame, {{&header, sizeof(header)}, {message.data(), message.size()}});
+        return frame;
+    }
+}
+
+struct PricingServer::State {
+    BatchPricer black_scholes;
+    BatchPricer monte_carlo;
+    std::unique_ptr<ThreadPool> pool;
+
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> listening{false};
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_ready;
+    std::deque<PendingRequest> queue;
+    std::size_t queued_options{0};
+    bool batcher_stopping{false};
+
+    std::vector<std::shared_ptr<Connection>> connections;   // accept loop only
+
+    mutable std::mutex statistics_mutex;
+    LatencyHistogram latency;
+    WireStatistics totals{};
+
+    Workspace workspace;
+
+    explicit State(const PricingServerParameters &parameters)
+        : black_scholes{BatchPricerParameters{BatchMethod::BlackScholes, parameters.num_paths, parameters.num_threads,
+                                              65536, 4, parameters.random_seed}},
+          monte_carlo{BatchPricerParameters{BatchMethod::MonteCarlo, parameters.num_paths, parameters.num_threads,
+                                            65536, 4, parameters.random_seed}},
+          pool{black_scholes.makePool()} {}
+
+    void countError() {
+        const std::lock_guard lock{statistics_mutex};
+        ++totals.errors;
+    }
+
+    [[nodiscard]] WireStatistics snapshot() const {
+        const std::lock_guard lock{statistics_mutex};
+        WireStatistics statistics = totals;
+        statistics.mean_batch_options = totals.batches > 0 ? static_cast<double>(totals.options) / totals.batches : 0.0;
+        statistics.p50_us = latency.percentile(0.5) / 1e3;
+        statistics.p99_us = latency.percentile(0.99) / 1e3;
+        statistics.max_us = latency.max() / 1e3;
+        return statistics;
+    }
+
+    void readRequests(const std::shared_ptr<Connection> &connection);
+    void writeResponses(const std::shared_ptr<Connection> &connection);
+    void batchRequests(const PricingServerParameters &parameters);
+    void priceBatch(std::vector<PendingRequest> &batch);
+};
+
+void PricingServer::State::readRequests(const std::shared_ptr<Connection> &connection) {
+    std::vector<unsigned char> payload;
+
+    try {
+        while (readFrame(connection->fd, payload, maxRequestBytes())) {
+            const Clock::time_point received = Clock::now();
+            RequestHeader header{};
+            if (payload.size() < sizeof(header)) throw std::runtime_error("Request shorter than its header");
+            std::memcpy(&header, payload.data(), sizeof(header));
+
+            if (header.type == RequestType::Stats) {
+                const ResponseHeader response{header.id, Status::Ok, 1};
+                const WireStatistics statistics = snapshot();
+                std::vector<unsigned char> frame;
+                appendFrame(frame, {{&response, sizeof(response)}, {&statistics, sizeof(statistics)}});
+                connection->post({std::move(frame), 0, received, false}, false);
+                continue;
+            }
+
+            // A size mismatch means the stream can no longer be framed, so the connection is dropped
+            if (header.type != RequestType::Price) throw std::runtime_error("Unknown request type");
+            if (header.count > MAX_REQUEST_OPTIONS
+                || payload.size() != sizeof(header) + static_cast<std::size_t>(header.count) * sizeof(WireOption)) {
+                throw std::runtime_error("Request size does not match its option count");
+            }
+
+            std::string error;
+            if (header.method != Method::BlackScholes && header.method != Method::MonteCarlo) {
+                error = "method must be 0 (Black-Scholes) or 1 (Monte Carlo)";
+            }
+
+            PendingRequest request{connection, header.id, header.method, std::vector<WireOption>(header.count), received, {}};
+            if (header.count > 0) {
+                std::memcpy(request.options.data(), payload.data() + sizeof(header), header.count * sizeof(WireOption));
+            }
+            for (std::size_t i = 0; error.empty() && i < request.options.size(); ++i) {
+                const std::string reason = validate(request.options[i]);
+                if (!reason.empty()) error = "option " + std::to_string(i) + ": " + reason;
+            }
+
+            // Rejected requests are queued too, so their error cannot overtake earlier responses
+            if (!error.empty()) {
+                request.options.clear();
+                request.error = std::move(error);
+            }
+
+            connection->expect();
+            {
+                const std::lock_guard lock{queue_mutex};
+                queued_options += request.options.size();
+                queue.push_back(std::move(request));
+            }
+            queue_ready.notify_one();
+        }
+    } catch (const std::exception &) {
+        // Malformed stream or a failed read: drop the connection, responses already queued still go out
+        countError();
+        ::shutdown(connection->fd, SHUT_RDWR);
+    }
+    connection->stopReading();
+}
+
+void PricingServer::State::writeResponses(const std::shared_ptr<Connection> &connection) {
+    Connection::Outgoing response;
+    bool open = true;
+
+    while (connection->next(response)) {
+        if (open) {
+            try {
+                writeAll(connection->fd, response.frame.data(), response.frame.size());
+            } catch (const std::exception &) {
+                // Failed or timed out: drop the client rather than retry every later response
+                open = false;
+                ::shutdown(connection->fd, SHUT_RDWR);
+            }
+        }
+        if (!response.priced) continue;
+
+        const auto latency_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - response.received);
+        const std::lock_guard lock{statistics_mutex};
+        if (open) {
+            latency.record(static_cast<std::uint64_t>(latency_ns.count()));
+            ++totals.requests;
+            totals.options += response.options;
+        } else {
+            ++totals.errors;
+        }
+    }
+    connection->finished.store(true);
+}
+
+void PricingServer::State::batchRequests(const PricingServerParameters &parameters) {
+    const auto max_delay = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::micro>(parameters.max_delay_us)
+    );
+    std::vector<PendingRequest> batch;
+
+    while (true) {
+        {
+            std::unique_lock lock{queue_mutex};
+            queue_ready.wait(lock, [this] { return batcher_stopping || !queue.empty(); });
+            if (queue.empty()) return;
+
+            // The first request's deadline bounds how long anything in this batch waits
+            const Clock::time_point deadline = queue.front().received + max_delay;
+            queue_ready.wait_until(lock, deadline, [&] {
+                return batcher_stopping || queued_options >= parameters.max_batch_options;
+            });
+
+            batch.assign(std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.end()));
+            queue.clear();
+            queued_options = 0;
+        }
+
+        priceBatch(batch);
+        batch.clear();
+    }
+}
+
+void PricingServer::State::priceBatch(std::vector<PendingRequest> &batch) {
+    Workspace &work = workspace;
+    std::size_t total_options = 0;
+    for (const PendingRequest &request: batch) total_options += request.options.size();
+    work.resize(total_options);
+
+    // Gather every request of a method into one contiguous run, Black-Scholes first
+    std::vector<std::size_t> offsets(batch.size());
+    std::size_t next = 0;
+    for (const Method method: {Method::BlackScholes, Method::MonteCarlo}) {
+        const std::size_t first = next;
+        for (std::size_t r = 0; r < batch.size(); ++r) {
+            if (batch[r].method != method || !batch[r].error.empty()) continue;
+            offsets[r] = next;
+            for (const WireOption &option: batch[r].options) {
+                work.spot[next] = option.spot;
+                work.strike[next] = option.strike;
+                work.rate[next] = option.rate;
+                work.volatility[next] = option.volatility;
+                work.expiry[next] = option.expiry;
+                work.type[next] = option.type == 0 ? Option::Type::CALL : Option::Type::PUT;
+                ++next;
+            }
+        }
+        if (next == first) continue;
+
+        const OptionBatch book = work.book(total_options);
+        const OptionBatch slice{
+            book.strike + first, book.expiry + first, book.type + first,
+            book.spot + first, book.rate + first, book.volatility + first, next - first
+        };
+        const BatchResults all = work.results();
+        const BatchResults results{
+            all.price + first, all.delta + first, all.gamma + first, all.vega + first, all.theta + first, all.rho + first
+        };
+
+        if (method == Method::MonteCarlo) {
+            monte_carlo.price(slice, results, work.standard_error.data() + first, pool.get());
+        } else {
+            std::fill(work.standard_error.begin() + static_cast<std::ptrdiff_t>(first),
+                      work.standard_error.begin() + static_cast<std::ptrdiff_t>(next),
+                      std::numeric_limits<double>::quiet_NaN());
+            black_scholes.price(slice, results, nullptr, pool.get());
+        }
+    }
+
+    // Respond in arrival order
+    for (std::size_t r = 0; r < batch.size(); ++r) {
+        const PendingRequest &request = batch[r];
+        if (!request.error.empty()) {
+            request.connection->post({errorFrame(request.id, request.error), 0, request.received, false}, true);
+            countError();
+            continue;
+        }
+
+        const std::size_t count = request.options.size();
+        work.response.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t k = offsets[r] + i;
+            work.response[i] = WireResult{
+                work.price[k], work.standard_error[k], work.delta[k], work.gamma[k], work.vega[k], work.theta[k], work.rho[k]
+            };
+        }
+
+        const ResponseHeader header{request.id, Status::Ok, static_cast<std::uint32_t>(count)};
+        std::vector<unsigned char> frame;
+        appendFrame(frame, {{&header, sizeof(header)}, {work.response.data(), count * sizeof(WireResult)}});
+        request.connection->post({std::move(frame), count, request.received, true}, true);
+    }
+
+    const std::lock_guard lock{statistics_mutex};
+    ++totals.batches;
+}
+
+PricingServer::PricingServer(const PricingServerParameters &parameters)
+    : parameters_{parameters}, state_{std::make_unique<State>(parameters)} {
+    parameters_.validate();
+}
+
+PricingServer::~PricingServer() = default;
+
+void PricingServer::stop() {
+    state_->stopping.store(true);
+}
+
+bool PricingServer::listening() const {
+    return state_->listening.load();
+}
+
+WireStatistics PricingServer::statistics() const {
+    return state_->snapshot();
+}
+
+void PricingServer::run() {
+    State &state = *state_;
+    const std::string &path = parameters_.socket_path;
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) throw std::invalid_argument("Socket path is too long: " + path);
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    // Replace a socket left behind by an earlier server, never a regular file
+    struct stat existing{};
+    if (::stat(path.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) throw std::invalid_argument("Not a socket: " + path);
+        ::unlink(path.c_str());
+    }
+
+    const int listener = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listener < 0) throw std::runtime_error(std::string{"Cannot create socket: "} + std::strerror(errno));
+    if (::bind(listener, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0
+        || ::listen(listener, SOMAXCONN) != 0) {
+        const std::string reason = std::strerror(errno);
+        ::close(listener);
+        throw std::runtime_error("Cannot listen on " + path + ": " + reason);
+    }
+
+    std::thread batcher{[&] { state.batchRequests(parameters_); }};
+    state.listening.store(true);
+
+    while (!state.stopping.load()) {
+        pollfd ready{listener, POLLIN, 0};
+        if (::poll(&ready, 1, accept_poll_ms) <= 0) continue;
+
+        const int fd = ::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) continue;
+        const timeval timeout{send_timeout_s, 0};
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        // Join the threads of closed connections once their last response is out
+        auto &connections = state.connections;
+        for (auto it = connections.begin(); it != connections.end();) {
+            if ((*it)->finished.load()) {
+                (*it)->reader.join();
+                (*it)->writer.join();
+                it = connections.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        auto connection = std::make_shared<Connection>(fd);
+        connection->reader = std::thread{[&state, connection] { state.readRequests(connection); }};
+        connection->writer = std::thread{[&state, connection] { state.writeResponses(connection); }};
+        connections.push_back(std::move(connection));
+    }
+
+    state.listening.store(false);
+    ::close(listener);
+    ::unlink(path.c_str());
+
+    // Readers first, so nothing is queued once the batcher drains and exits; writers then flush
+    for (const auto &connection: state.connections) ::shutdown(connection->fd, SHUT_RD);
+    for (const auto &connection: state.connections) connection->reader.join();
+
+    {
+        const std::lock_guard lock{state.queue_mutex};
+        state.batcher_stopping = true;
+    }
+    state.queue_ready.notify_all();
+    batcher.join();
+
+    for (const auto &connection: state.connections) connection->writer.join();
+    state.connections.clear();
+}
@@ -0,0 +1,95 @@
+#include "quasi_monte_carlo.h"
+#include "financial_math.h"
+#include "philox.h"
+#include "running_statistics.h"
+#include <bitset>
+#include <cmath>
+
+ScrambledSobol::ScrambledSobol(const std::uint64_t seed, const std::uint64_t replicate)
+    : directions_{}, state_{0}, index_{0} {
+    const Philox4x32::Key key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+
+    // 32 matrix rows plus the shift, four words per Philox call
+    std::array<std::uint32_t, 36> random_words{};
+    for (std::uint32_t block = 0; block < 9; ++block) {
+        const Philox4x32::Counter bits = Philox4x32::generate(
+            {static_cast<std::uint32_t>(replicate), static_cast<std::uint32_t>(replicate >> 32), block, 0x5EED},
+            key
+        );
+        for (int i = 0; i < 4; ++i) {
+            random_words[4 * block + i] = bits[i];
+        }
+    }
+
+    // Row i produces output digit i (bit 31 - i): its own digit plus random higher digits
+    std::array<std::uint32_t, 32> rows{};
+    for (int i = 0; i < 32; ++i) {
+        const int position = 31 - i;
+        const auto higher_digits = static_cast<std::uint32_t>(~((std::uint64_t{1} << (position + 1)) - 1));
+        rows[i] = (std::uint32_t{1} << position) | (random_words[i] & higher_digits);
+    }
+
+    for (int k = 0; k < 32; ++k) {
+        const std::uint32_t direction = std::uint32_t{1} << (31 - k);
+        std::uint32_t scrambled = 0;
+        for (int i = 0; i < 32; ++i) {
+            const auto parity = static_cast<std::uint32_t>(std::bitset<32>(rows[i] & direction).count() & 1);
+            scrambled |= parity << (31 - i);
+        }
+        directions_[k] = scrambled;
+    }
+
+    state_ = random_words[32];
+}
+
+double ScrambledSobol::next() {
+    const double point = (static_cast<double>(state_) + 0.5) * 0x1.0p-32;
+
+    // Gray code: flip the direction of the lowest zero bit of the index
+    int bit = 0;
+    for (std::uint32_t value = index_; value & 1; value >>= 1) {
+        ++bit;
+    }
+    state_ ^= directions_[bit];
+    ++index_;
+
+    return point;
+}
+
+PricingResult QuasiMonteCarloEngine::price(
+    const Option &option,
+    const MarketParameters &market_parameters
+) const {
+    const double rate = market_parameters.risk_free_rate;
+    const double time = option.getExpiry();
+    const double drift = FinancialMath::calculateDriftTerm(rate, market_parameters.volatility, time);
+
+    RunningStatistics replicate_means;
+
+    for (int replicate = 0; replicate < parameters_.num_replicates; ++replicate) {
+        ScrambledSobol sobol{parameters_.random_seed, static_cast<std::uint64_t>(replicate)};
+
+        RunningStatistics payoffs;
+        for (int i = 0; i < parameters_.points_per_replicate; ++i) {
+            const double shock = FinancialMath::normalQuantile(sobol.next());
+            const double vol_term = FinancialMath::calculateVolatilityTerm(market_parameters.volatility, time, shock);
+            const double final_spot = FinancialMath::simulateGeometricBrownianMotion(
+                market_parameters.spot_price, drift, vol_term
+            );
+            payoffs.add(option.payoff(final_spot));
+        }
+
+        replicate_means.add(payoffs.mean());
+    }
+
+    const int points_used = parameters_.points_per_replicate * parameters_.num_replicates;
+    const double present_price = FinancialMath::discountToPresent(replicate_means.mean(), rate, time);
+    const double present_error = FinancialMath::discountToPresent(replicate_means.standardError(), rate, time);
+
+    return PricingResult{present_price, present_error, points_used, "Quasi-Monte Carlo"};
+}
+
+std::string QuasiMonteCarloEngine::getName() const {
+    return "Quasi-Monte Carlo (" + std::to_string(parameters_.num_replicates) + " x "
+           + std::to_string(parameters_.points_per_replicate) + " Sobol points)";
+}
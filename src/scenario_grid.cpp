@@ -0,0 +1,231 @@
+#include "scenario_grid.h"
+#include "simd.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    using Simd::DoubleVec;
+
+    constexpr std::size_t lanes = DoubleVec::width;
+    constexpr std::size_t tile_options = ScenarioGridEngine::TILE_OPTIONS;
+    static_assert(tile_options % lanes == 0, "Tiles must hold whole vectors");
+
+    // One tile of the book, padded with zero-quantity copies of its first option so every loop runs on whole vectors
+    struct Tile {
+        double log_moneyness[tile_options];
+        double spot[tile_options];
+        double strike[tile_options];
+        double omega[tile_options];
+        double rate[tile_options];
+        double volatility[tile_options];
+        double expiry[tile_options];
+        double quantity[tile_options];
+        double base[tile_options];
+
+        // Per time shift: remaining expiry (1 where expired), its sqrt, discounted strike, expired flag
+        double tau[tile_options];
+        double sqrt_tau[tile_options];
+        double discounted_strike[tile_options];
+        double expired[tile_options];
+
+        std::size_t vectors;
+
+        void load(const OptionBatch &book, const double *quantities, const std::size_t first, const std::size_t count) {
+            for (std::size_t k = 0; k < tile_options; ++k) {
+                const bool real = k < count;
+                const std::size_t i = real ? first + k : first;
+                spot[k] = book.spot[i];
+                strike[k] = book.strike[i];
+                omega[k] = book.type[i] == Option::Type::PUT ? -1.0 : 1.0;
+                rate[k] = book.rate[i];
+                volatility[k] = book.volatility[i];
+                expiry[k] = book.expiry[i];
+                quantity[k] = real ? quantities[i] : 0.0;
+            }
+            vectors = (count + lanes - 1) / lanes;
+
+            for (std::size_t k = 0; k < vectors * lanes; k += lanes) {
+                Simd::log(DoubleVec::load(spot + k) / DoubleVec::load(strike + k)).store(log_moneyness + k);
+            }
+        }
+
+        void prepareTime(const double elapsed) {
+            for (std::size_t k = 0; k < vectors * lanes; k += lanes) {
+                const DoubleVec remaining = DoubleVec::load(expiry + k) - elapsed;
+                const auto live = remaining > 0.0;
+                const DoubleVec safe = Simd::select(live, remaining, 1.0);
+
+                safe.store(tau + k);
+                Simd::sqrt(safe).store(sqrt_tau + k);
+                (DoubleVec::load(strike + k) * Simd::exp(-DoubleVec::load(rate + k) * safe)).store(discounted_strike + k);
+                Simd::select(live, 0.0, 1.0).store(expired + k);
+            }
+        }
+    };
+
+    // Terms of d1 and d2 shared by every spot shift of one vol shift
+    struct VolTerms {
+        DoubleVec vol_sqrt_tau;
+        DoubleVec inv_vol_sqrt_tau;
+        DoubleVec drift;
+    };
+
+    VolTerms volTerms(const Tile &tile, const std::size_t k, const double vol_shift) {
+        const DoubleVec volatility = DoubleVec::load(tile.volatility + k) + vol_shift;
+        const DoubleVec tau = DoubleVec::load(tile.tau + k);
+        const DoubleVec vol_sqrt_tau = volatility * DoubleVec::load(tile.sqrt_tau + k);
+        return {
+            vol_sqrt_tau,
+            1.0 / vol_sqrt_tau,
+            Simd::fma(0.5 * volatility, volatility, DoubleVec::load(tile.rate + k)) * tau
+        };
+    }
+
+    // Black-Scholes value of vector k of the tile at spot factor 1 + shift, with the tile's current time terms
+    template<CdfAccuracy Accuracy>
+    DoubleVec value(
+        const Tile &tile,
+        const std::size_t k,
+        const VolTerms &terms,
+        const double spot_factor,
+        const double log_spot_factor,
+        const bool any_expired
+    ) {
+        const DoubleVec omega = DoubleVec::load(tile.omega + k);
+        const DoubleVec spot = DoubleVec::load(tile.spot + k) * spot_factor;
+        const DoubleVec discounted_strike = DoubleVec::load(tile.discounted_strike + k);
+
+        const DoubleVec d1 = (DoubleVec::load(tile.log_moneyness + k) + log_spot_factor + terms.drift) * terms.inv_vol_sqrt_tau;
+        const DoubleVec d2 = d1 - terms.vol_sqrt_tau;
+        const DoubleVec price = omega * (spot * FinancialMath::normalCDF<Accuracy>(omega * d1)
+                                         - discounted_strike * FinancialMath::normalCDF<Accuracy>(omega * d2));
+        if (!any_expired) return price;
+
+        const DoubleVec intrinsic = Simd::max(omega * (spot - DoubleVec::load(tile.strike + k)), 0.0);
+        return Simd::select(DoubleVec::load(tile.expired + k) > 0.0, intrinsic, price);
+    }
+
+    template<CdfAccuracy Accuracy>
+    void runTile(
+        Tile &tile,
+        const ScenarioAxes &axes,
+        const std::vector<double> &log_spot_factors,
+        std::vector<DoubleVec> &accumulators,
+        double *cube
+    ) {
+        const std::size_t spots = axes.spot_shifts.size();
+        const std::size_t vols = axes.vol_shifts.size();
+
+        // Base values: no shift
+        tile.prepareTime(0.0);
+        for (std::size_t k = 0; k < tile.vectors * lanes; k += lanes) {
+            value<Accuracy>(tile, k, volTerms(tile, k, 0.0), 1.0, 0.0, false).store(tile.base + k);
+        }
+
+        for (std::size_t t = 0; t < axes.time_shifts.size(); ++t) {
+            tile.prepareTime(axes.time_shifts[t]);
+            bool any_expired = false;
+            for (std::size_t k = 0; k < tile.vectors * lanes; ++k) {
+                any_expired = any_expired || tile.expired[k] > 0.0;
+            }
+
+            for (std::size_t v = 0; v < vols; ++v) {
+                std::fill(accumulators.begin(), accumulators.end(), DoubleVec{0.0});
+
+                for (std::size_t k = 0; k < tile.vectors * lanes; k += lanes) {
+                    const VolTerms terms = volTerms(tile, k, axes.vol_shifts[v]);
+                    const DoubleVec quantity = DoubleVec::load(tile.quantity + k);
+                    const DoubleVec base = DoubleVec::load(tile.base + k);
+
+                    for (std::size_t s = 0; s < spots; ++s) {
+                        const DoubleVec scenario = value<Accuracy>(
+                            tile, k, terms, 1.0 + axes.spot_shifts[s], log_spot_factors[s], any_expired
+                        );
+                        accumulators[s] = Simd::fma(quantity, scenario - base, accumulators[s]);
+                    }
+                }
+
+                double *row = cube + (t * vols + v) * spots;
+                for (std::size_t s = 0; s < spots; ++s) {
+                    double lane_values[lanes];
+                    accumulators[s].store(lane_values);
+                    double total = 0.0;
+                    for (const double lane_value: lane_values) {
+                        total += lane_value;
+                    }
+                    row[s] = total;
+                }
+            }
+        }
+    }
+
+    template<CdfAccuracy Accuracy>
+    void runTiles(
+        const OptionBatch &book,
+        const double *quantities,
+        const ScenarioAxes &axes,
+        std::vector<std::vector<double>> &partials,
+        ThreadPool *pool
+    ) {
+        std::vector<double> log_spot_factors(axes.spot_shifts.size());
+        for (std::size_t s = 0; s < log_spot_factors.size(); ++s) {
+            log_spot_factors[s] = std::log1p(axes.spot_shifts[s]);
+        }
+
+        const auto run = [&](const std::size_t index) {
+            thread_local Tile tile;
+            thread_local std::vector<DoubleVec> accumulators;
+            accumulators.resize(axes.spot_shifts.size());
+
+            const std::size_t first = index * tile_options;
+            tile.load(book, quantities, first, std::min(tile_options, book.size - first));
+            partials[index].assign(axes.size(), 0.0);
+            runTile<Accuracy>(tile, axes, log_spot_factors, accumulators, partials[index].data());
+        };
+
+        if (pool) {
+            pool->parallelFor(partials.size(), run);
+        } else {
+            for (std::size_t index = 0; index < partials.size(); ++index) {
+                run(index);
+            }
+        }
+    }
+}
+
+ScenarioGridEngine::ScenarioGridEngine(const unsigned int num_threads, const CdfAccuracy cdf_accuracy)
+    : cdf_accuracy_{cdf_accuracy} {
+    const unsigned int threads = num_threads == 0 ? ThreadPool::hardwareThreads() : num_threads;
+    if (threads > 1) {
+        thread_pool_ = std::make_shared<ThreadPool>(threads);
+    }
+}
+
+PnlCube ScenarioGridEngine::run(const OptionBatch &book, const double *quantities, const ScenarioAxes &axes) const {
+    PnlCube cube{axes.spot_shifts.size(), axes.vol_shifts.size(), axes.time_shifts.size()};
+    if (book.size == 0 || axes.size() == 0) return cube;
+
+    const double min_vol_shift = *std::min_element(axes.vol_shifts.begin(), axes.vol_shifts.end());
+    const double min_spot_shift = *std::min_element(axes.spot_shifts.begin(), axes.spot_shifts.end());
+    if (min_spot_shift <= -1.0) throw std::invalid_argument("Spot shifts must keep the spot positive");
+    for (std::size_t i = 0; i < book.size; ++i) {
+        if (book.volatility[i] + min_vol_shift <= 0) throw std::invalid_argument("Vol shifts must keep volatility positive");
+    }
+
+    // Tile partials, summed in tile order below
+    std::vector<std::vector<double>> partials((book.size + TILE_OPTIONS - 1) / TILE_OPTIONS);
+    switch (cdf_accuracy_) {
+        case CdfAccuracy::High: runTiles<CdfAccuracy::High>(book, quantities, axes, partials, thread_pool_.get()); break;
+        case CdfAccuracy::Fast: runTiles<CdfAccuracy::Fast>(book, quantities, axes, partials, thread_pool_.get()); break;
+        default: runTiles<CdfAccuracy::Full>(book, quantities, axes, partials, thread_pool_.get()); break;
+    }
+
+    std::vector<double> &values = cube.values();
+    for (const std::vector<double> &partial: partials) {
+        for (std::size_t n = 0; n < values.size(); ++n) {
+            values[n] += partial[n];
+        }
+    }
+    return cube;
+}
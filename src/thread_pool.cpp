@@ -0,0 +1,104 @@
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(unsigned int num_threads)
+    : task_{nullptr}, task_count_{0}, next_index_{0}, active_workers_{0}, generation_{0}, stopping_{false} {
+    if (num_threads == 0) {
+        num_threads = hardwareThreads();
+    }
+
+    for (unsigned int i = 1; i < num_threads; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        const std::lock_guard lock{state_mutex_};
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+
+    for (std::thread &worker: workers_) {
+        worker.join();
+    }
+}
+
+unsigned int ThreadPool::hardwareThreads() {
+    const unsigned int threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+void ThreadPool::drain() {
+    try {
+        for (std::size_t i = next_index_.fetch_add(1); i < task_count_; i = next_index_.fetch_add(1)) {
+            (*task_)(i);
+        }
+    } catch (...) {
+        const std::lock_guard lock{state_mutex_};
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+        // Stop handing out the remaining indices
+        next_index_.store(task_count_);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    std::size_t seen_generation = 0;
+
+    while (true) {
+        {
+            std::unique_lock lock{state_mutex_};
+            work_ready_.wait(lock, [&]() { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) return;
+            seen_generation = generation_;
+        }
+
+        drain();
+
+        {
+            const std::lock_guard lock{state_mutex_};
+            if (--active_workers_ == 0) {
+                work_done_.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::parallelFor(const std::size_t count, const std::function<void(std::size_t)> &task) {
+    if (count == 0) return;
+
+    if (workers_.empty() || count == 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    const std::lock_guard submit_lock{submit_mutex_};
+
+    {
+        const std::lock_guard lock{state_mutex_};
+        task_ = &task;
+        task_count_ = count;
+        next_index_.store(0);
+        active_workers_ = static_cast<unsigned int>(workers_.size());
+        error_ = nullptr;
+        ++generation_;
+    }
+    work_ready_.notify_all();
+
+    drain();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock lock{state_mutex_};
+        work_done_.wait(lock, [&]() { return active_workers_ == 0; });
+        task_ = nullptr;
+        error = error_;
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
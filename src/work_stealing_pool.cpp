@@ -0,0 +1,107 @@
+#include "work_stealing_pool.h"
+#include "thread_pool.h"
+
+namespace {
+    // Set while a thread runs inside a pool, so nested submits stay on the local deque
+    thread_local const WorkStealingPool *current_pool = nullptr;
+    thread_local unsigned int current_worker = 0;
+}
+
+WorkStealingPool::WorkStealingPool(unsigned int num_threads)
+    : queued_{0}, next_queue_{0}, stopping_{false} {
+    if (num_threads == 0) {
+        num_threads = ThreadPool::hardwareThreads();
+    }
+
+    for (unsigned int i = 0; i < num_threads; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (unsigned int i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        const std::lock_guard lock{state_mutex_};
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+
+    for (std::thread &worker: workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(Task task, const TaskPriority priority) {
+    // Counted before the push: a worker woken early just retries until the task shows up
+    {
+        const std::lock_guard lock{state_mutex_};
+        ++queued_;
+    }
+
+    if (priority == TaskPriority::High) {
+        const std::lock_guard lock{high_mutex_};
+        high_tasks_.push_back(std::move(task));
+    } else {
+        const unsigned int queue = current_pool == this
+                                       ? current_worker
+                                       : next_queue_.fetch_add(1) % static_cast<unsigned int>(queues_.size());
+        const std::lock_guard lock{queues_[queue]->mutex};
+        queues_[queue]->tasks.push_back(std::move(task));
+    }
+
+    work_ready_.notify_one();
+}
+
+bool WorkStealingPool::tryPop(const unsigned int worker, Task &task) {
+    {
+        const std::lock_guard lock{high_mutex_};
+        if (!high_tasks_.empty()) {
+            task = std::move(high_tasks_.front());
+            high_tasks_.pop_front();
+            return true;
+        }
+    }
+
+    WorkerQueue &own = *queues_[worker];
+    const std::lock_guard lock{own.mutex};
+    if (own.tasks.empty()) return false;
+
+    task = std::move(own.tasks.back());
+    own.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::trySteal(const unsigned int worker, Task &task) {
+    const auto count = static_cast<unsigned int>(queues_.size());
+
+    for (unsigned int offset = 1; offset < count; ++offset) {
+        WorkerQueue &victim = *queues_[(worker + offset) % count];
+        const std::lock_guard lock{victim.mutex};
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(const unsigned int worker) {
+    current_pool = this;
+    current_worker = worker;
+
+    while (true) {
+        Task task;
+        if (tryPop(worker, task) || trySteal(worker, task)) {
+            --queued_;
+            task(worker);
+            continue;
+        }
+
+        std::unique_lock lock{state_mutex_};
+        work_ready_.wait(lock, [&]() { return stopping_ || queued_.load() > 0; });
+        if (stopping_ && queued_.load() <= 0) return;
+    }
+}